@@ -11,9 +11,11 @@
 #include <nanorange/algorithm/adjacent_find.hpp>
 #include <nanorange/algorithm/all_of.hpp>
 #include <nanorange/algorithm/any_of.hpp>
+#include <nanorange/algorithm/batch_lower_bound.hpp>
 #include <nanorange/algorithm/binary_search.hpp>
 #include <nanorange/algorithm/copy.hpp>
 #include <nanorange/algorithm/count.hpp>
+#include <nanorange/algorithm/dary_heap.hpp>
 #include <nanorange/algorithm/equal.hpp>
 #include <nanorange/algorithm/equal_range.hpp>
 #include <nanorange/algorithm/fill.hpp>
@@ -25,6 +27,7 @@
 #include <nanorange/algorithm/generate.hpp>
 #include <nanorange/algorithm/generate_n.hpp>
 #include <nanorange/algorithm/includes.hpp>
+#include <nanorange/algorithm/inplace_merge.hpp>
 #include <nanorange/algorithm/is_heap.hpp>
 #include <nanorange/algorithm/is_heap_until.hpp>
 #include <nanorange/algorithm/is_partitioned.hpp>
@@ -37,6 +40,7 @@
 #include <nanorange/algorithm/max.hpp>
 #include <nanorange/algorithm/max_element.hpp>
 #include <nanorange/algorithm/merge.hpp>
+#include <nanorange/algorithm/merge_k.hpp>
 #include <nanorange/algorithm/min.hpp>
 #include <nanorange/algorithm/min_element.hpp>
 #include <nanorange/algorithm/minmax.hpp>
@@ -45,6 +49,7 @@
 #include <nanorange/algorithm/move.hpp>
 #include <nanorange/algorithm/next_permutation.hpp>
 #include <nanorange/algorithm/none_of.hpp>
+#include <nanorange/algorithm/nth_element.hpp>
 #include <nanorange/algorithm/partial_sort.hpp>
 #include <nanorange/algorithm/partial_sort_copy.hpp>
 #include <nanorange/algorithm/partition.hpp>
@@ -67,6 +72,7 @@
 #include <nanorange/algorithm/rotate_copy.hpp>
 #include <nanorange/algorithm/search.hpp>
 #include <nanorange/algorithm/search_n.hpp>
+#include <nanorange/algorithm/searchers.hpp>
 #include <nanorange/algorithm/set_difference.hpp>
 #include <nanorange/algorithm/set_intersection.hpp>
 #include <nanorange/algorithm/set_symmetric_difference.hpp>
@@ -74,16 +80,14 @@
 #include <nanorange/algorithm/shuffle.hpp>
 #include <nanorange/algorithm/sort.hpp>
 #include <nanorange/algorithm/sort_heap.hpp>
+#include <nanorange/algorithm/sorted_index.hpp>
+#include <nanorange/algorithm/stable_partition.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
 #include <nanorange/algorithm/swap_ranges.hpp>
+#include <nanorange/algorithm/top_k.hpp>
 #include <nanorange/algorithm/transform.hpp>
 #include <nanorange/algorithm/unique.hpp>
 #include <nanorange/algorithm/unique_copy.hpp>
 #include <nanorange/algorithm/upper_bound.hpp>
 
-// Algorithms which reuse the STL implementation
-#include <nanorange/algorithm/stl/inplace_merge.hpp>
-#include <nanorange/algorithm/stl/nth_element.hpp>
-#include <nanorange/algorithm/stl/stable_partition.hpp>
-#include <nanorange/algorithm/stl/stable_sort.hpp>
-
 #endif
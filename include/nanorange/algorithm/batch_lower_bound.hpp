@@ -0,0 +1,119 @@
+// nanorange/algorithm/batch_lower_bound.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_BATCH_LOWER_BOUND_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_BATCH_LOWER_BOUND_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+#include <nanorange/algorithm/partition_point.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: writes nano::lower_bound(haystack, needle, comp, proj) for each
+// needle in turn to the output, searching for several needles at once so
+// that their memory accesses overlap
+
+template <typename I, typename O>
+using batch_lower_bound_result = copy_result<I, O>;
+
+namespace detail {
+
+// The number of searches which batch_lower_bound runs at once
+constexpr int batch_lower_bound_group_size = 16;
+
+struct batch_lower_bound_fn {
+private:
+    template <typename N, typename Comp>
+    struct compare {
+        const N* needles;
+        Comp& comp;
+
+        template <typename U>
+        constexpr bool operator()(int j, U&& u) const
+        {
+            return nano::invoke(comp, std::forward<U>(u), *needles[j]);
+        }
+    };
+
+    template <typename I1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj>
+    static constexpr batch_lower_bound_result<I2, O>
+    impl(I1 first, iter_difference_t<I1> n, I2 nfirst, S2 nlast, O out,
+         Comp& comp, Proj& proj)
+    {
+        constexpr int group_size = batch_lower_bound_group_size;
+
+        I2 needles[group_size]{};
+        I1 pos[group_size]{};
+        const auto pred = compare<I2, Comp>{needles, comp};
+
+        while (nfirst != nlast) {
+            int count = 0;
+            for (; count < group_size && nfirst != nlast; ++count, ++nfirst) {
+                needles[count] = nfirst;
+            }
+
+            partition_point_fn::impl_n_batch(first, n, pos, count, pred, proj);
+
+            for (int j = 0; j < count; ++j, ++out) {
+                *out = pos[j];
+            }
+        }
+
+        return {std::move(nfirst), std::move(out)};
+    }
+
+public:
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I1> &&
+        Sentinel<S1, I1> &&
+        ForwardIterator<I2> &&
+        Sentinel<S2, I2> &&
+        WeaklyIncrementable<O> &&
+        Writable<O, const I1&> &&
+        IndirectStrictWeakOrder<Comp, projected<I1, Proj>, I2>,
+        batch_lower_bound_result<I2, O>>
+    operator()(I1 first, S1 last, I2 nfirst, S2 nlast, O out,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, std::move(last));
+        return batch_lower_bound_fn::impl(std::move(first), n,
+                                          std::move(nfirst), std::move(nlast),
+                                          std::move(out), comp, proj);
+    }
+
+    // The haystack must not be a temporary, as the output refers into it
+    template <typename Rng1, typename Rng2, typename O,
+              typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessRange<Rng1> &&
+        ForwardingRange<Rng1> &&
+        ForwardRange<Rng2> &&
+        WeaklyIncrementable<O> &&
+        Writable<O, const iterator_t<Rng1>&> &&
+        IndirectStrictWeakOrder<Comp, projected<iterator_t<Rng1>, Proj>,
+                                iterator_t<Rng2>>,
+        batch_lower_bound_result<safe_iterator_t<Rng2>, O>>
+    operator()(Rng1&& haystack, Rng2&& needles, O out, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return batch_lower_bound_fn::impl(nano::begin(haystack),
+                                          nano::distance(haystack),
+                                          nano::begin(needles),
+                                          nano::end(needles), std::move(out),
+                                          comp, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::batch_lower_bound_fn, batch_lower_bound)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -7,6 +7,8 @@
 #ifndef NANORANGE_ALGORITHM_COPY_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_COPY_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/compact.hpp>
+#include <nanorange/detail/algorithm/memmove.hpp>
 #include <nanorange/iterator/operations.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -22,6 +24,22 @@ namespace detail {
 
 struct copy_fn {
 private:
+    // Contiguous ranges of trivially copyable types can be copied (or moved
+    // from, through a move_iterator) using memmove
+    template <typename I, typename U>
+    static constexpr auto impl(I first, I last, U* result, priority_tag<2>)
+        -> std::enable_if_t<memmove_assignable<I, U>, copy_result<I, U*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return {last, detail::memmove_copy(memmove_source<I>::base(first),
+                                               memmove_source<I>::base(last),
+                                               result)};
+        }
+
+        return copy_fn::impl(std::move(first), std::move(last), result,
+                             priority_tag<1>{});
+    }
+
     // If we know the distance between first and last, we can use that
     // information to (potentially) allow better codegen
     template <typename I, typename S, typename O>
@@ -52,6 +70,28 @@ private:
         return {std::move(first), std::move(result)};
     }
 
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename O>
+    static constexpr auto range_impl(Rng& rng, O result, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            copy_result<iterator_t<Rng>, O>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        auto res = copy_fn::impl(ptr, ptr + n, std::move(result),
+                                 priority_tag<2>{});
+        return {nano::begin(rng) + n, std::move(res.out)};
+    }
+
+    template <typename Rng, typename O>
+    static constexpr copy_result<iterator_t<Rng>, O>
+    range_impl(Rng& rng, O result, priority_tag<0>)
+    {
+        return copy_fn::impl(nano::begin(rng), nano::end(rng),
+                             std::move(result), priority_tag<2>{});
+    }
+
 public:
     template <typename I, typename S, typename O>
     constexpr std::enable_if_t<InputIterator<I> && Sentinel<S, I> &&
@@ -61,7 +101,7 @@ public:
     operator()(I first, S last, O result) const
     {
         return copy_fn::impl(std::move(first), std::move(last),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 
     template <typename Rng, typename O>
@@ -70,8 +110,7 @@ public:
                                copy_result<safe_iterator_t<Rng>, O>>
     operator()(Rng&& rng, O result) const
     {
-        return copy_fn::impl(nano::begin(rng), nano::end(rng),
-                             std::move(result), priority_tag<1>{});
+        return copy_fn::range_impl(rng, std::move(result), priority_tag<1>{});
     }
 };
 
@@ -85,11 +124,10 @@ using copy_n_result = copy_result<I, O>;
 namespace detail {
 
 struct copy_n_fn {
+private:
     template <typename I, typename O>
-    constexpr std::enable_if_t<InputIterator<I> && WeaklyIncrementable<O> &&
-                                   IndirectlyCopyable<I, O>,
-                               copy_n_result<I, O>>
-    operator()(I first, iter_difference_t<I> n, O result) const
+    static constexpr copy_n_result<I, O> impl(I first, iter_difference_t<I> n,
+                                              O result, priority_tag<0>)
     {
         for (iter_difference_t<I> i{}; i < n; i++) {
             *result = *first;
@@ -99,6 +137,32 @@ struct copy_n_fn {
 
         return {std::move(first), std::move(result)};
     }
+
+    template <typename I, typename U>
+    static constexpr auto impl(I first, iter_difference_t<I> n, U* result,
+                               priority_tag<1>)
+        -> std::enable_if_t<memmove_assignable<I, U>, copy_n_result<I, U*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            const I last = first + (n > 0 ? n : 0);
+            return {last, detail::memmove_copy(memmove_source<I>::base(first),
+                                               memmove_source<I>::base(last),
+                                               result)};
+        }
+
+        return copy_n_fn::impl(std::move(first), n, result, priority_tag<0>{});
+    }
+
+public:
+    template <typename I, typename O>
+    constexpr std::enable_if_t<InputIterator<I> && WeaklyIncrementable<O> &&
+                                   IndirectlyCopyable<I, O>,
+                               copy_n_result<I, O>>
+    operator()(I first, iter_difference_t<I> n, O result) const
+    {
+        return copy_n_fn::impl(std::move(first), n, std::move(result),
+                               priority_tag<1>{});
+    }
 };
 
 } // namespace detail
@@ -114,7 +178,8 @@ struct copy_if_fn {
 private:
     template <typename I, typename S, typename O, typename Pred, typename Proj>
     static constexpr copy_if_result<I, O> impl(I first, S last, O result,
-                                               Pred pred, Proj proj)
+                                               Pred& pred, Proj& proj,
+                                               priority_tag<0>)
     {
         while (first != last) {
             if (nano::invoke(pred, nano::invoke(proj, *first))) {
@@ -127,6 +192,43 @@ private:
         return {std::move(first), std::move(result)};
     }
 
+    // Contiguous ranges of small trivially copyable types can be filtered
+    // without branching on the predicate
+    template <typename T, typename O, typename Pred, typename Proj>
+    static constexpr auto impl(T* first, T* last, O result, Pred& pred,
+                               Proj& proj, priority_tag<1>)
+        -> std::enable_if_t<compactable<std::remove_const_t<T>>,
+                            copy_if_result<T*, O>>
+    {
+        return {last, detail::compact_copy_if<true>(first, last,
+                                                    std::move(result), pred,
+                                                    proj)};
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename O, typename Pred, typename Proj>
+    static constexpr auto range_impl(Rng& rng, O result, Pred& pred,
+                                     Proj& proj, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            copy_if_result<iterator_t<Rng>, O>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        auto res = copy_if_fn::impl(ptr, ptr + n, std::move(result), pred,
+                                    proj, priority_tag<1>{});
+        return {nano::begin(rng) + n, std::move(res.out)};
+    }
+
+    template <typename Rng, typename O, typename Pred, typename Proj>
+    static constexpr copy_if_result<iterator_t<Rng>, O>
+    range_impl(Rng& rng, O result, Pred& pred, Proj& proj, priority_tag<0>)
+    {
+        return copy_if_fn::impl(nano::begin(rng), nano::end(rng),
+                                std::move(result), pred, proj,
+                                priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename O, typename Proj = identity,
               typename Pred>
@@ -138,8 +240,8 @@ public:
     operator()(I first, S last, O result, Pred pred, Proj proj = Proj{}) const
     {
         return copy_if_fn::impl(std::move(first), std::move(last),
-                                std::move(result), std::move(pred),
-                                std::move(proj));
+                                std::move(result), pred, proj,
+                                priority_tag<1>{});
     }
 
     template <typename Rng, typename O, typename Proj = identity, typename Pred>
@@ -149,9 +251,8 @@ public:
         copy_if_result<safe_iterator_t<Rng>, O>>
     operator()(Rng&& rng, O result, Pred pred, Proj proj = Proj{}) const
     {
-        return copy_if_fn::impl(nano::begin(rng), nano::end(rng),
-                                std::move(result), std::move(pred),
-                                std::move(proj));
+        return copy_if_fn::range_impl(rng, std::move(result), pred, proj,
+                                      priority_tag<1>{});
     }
 };
 
@@ -168,7 +269,7 @@ struct copy_backward_fn {
 private:
     template <typename I1, typename S1, typename I2>
     static constexpr copy_backward_result<I1, I2>
-    impl(I1 first, S1 last, I2 result)
+    impl(I1 first, S1 last, I2 result, priority_tag<0>)
     {
         I1 last_it = nano::next(first, std::move(last));
         I1 it = last_it;
@@ -180,6 +281,38 @@ private:
         return {std::move(last_it), std::move(result)};
     }
 
+    template <typename T, typename U>
+    static constexpr auto impl(T* first, T* last, U* result, priority_tag<1>)
+        -> std::enable_if_t<memmove_assignable<T*, U>,
+                            copy_backward_result<T*, U*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return {last, detail::memmove_copy_backward(first, last, result)};
+        }
+
+        return copy_backward_fn::impl(first, last, result, priority_tag<0>{});
+    }
+
+    template <typename Rng, typename I>
+    static constexpr auto range_impl(Rng& rng, I result, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            copy_backward_result<iterator_t<Rng>, I>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        auto res = copy_backward_fn::impl(ptr, ptr + n, std::move(result),
+                                          priority_tag<1>{});
+        return {nano::begin(rng) + n, std::move(res.out)};
+    }
+
+    template <typename Rng, typename I>
+    static constexpr copy_backward_result<iterator_t<Rng>, I>
+    range_impl(Rng& rng, I result, priority_tag<0>)
+    {
+        return copy_backward_fn::impl(nano::begin(rng), nano::end(rng),
+                                      std::move(result), priority_tag<1>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2>
     constexpr std::enable_if_t<BidirectionalIterator<I1> && Sentinel<S1, I1> &&
@@ -189,7 +322,7 @@ public:
     operator()(I1 first, S1 last, I2 result) const
     {
         return copy_backward_fn::impl(std::move(first), std::move(last),
-                                      std::move(result));
+                                      std::move(result), priority_tag<1>{});
     }
 
     template <typename Rng, typename I>
@@ -199,8 +332,8 @@ public:
                                copy_backward_result<safe_iterator_t<Rng>, I>>
     operator()(Rng&& rng, I result) const
     {
-        return copy_backward_fn::impl(nano::begin(rng), nano::end(rng),
-                                      std::move(result));
+        return copy_backward_fn::range_impl(rng, std::move(result),
+                                            priority_tag<1>{});
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_COUNT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_COUNT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_reduce.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -66,16 +67,55 @@ namespace detail {
 
 struct count_fn {
 private:
-    template <typename ValueType>
-    struct equal_to_pred {
-        const ValueType& val;
-
-        template <typename T>
-        constexpr bool operator()(const T& t) const
-        {
-            return t == val;
+    template <typename I, typename S, typename T, typename Proj>
+    static constexpr iter_difference_t<I> impl(I first, S last, const T& value,
+                                               Proj& proj, priority_tag<0>)
+    {
+        const auto pred = equal_to_pred<T>{value};
+        return count_if_fn::impl(std::move(first), std::move(last),
+                                 pred, proj);
+    }
+
+    // Contiguous ranges of built-in types can be counted sixteen bytes at a
+    // time
+    template <typename E, typename T, typename Proj>
+    static constexpr auto impl(E* first, E* last, const T& value, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<simd_countable<E, T, Proj>, std::ptrdiff_t>
+    {
+        using V = std::remove_const_t<E>;
+
+        if (!detail::is_constant_evaluated()) {
+            // No element can compare equal to a value which fails this
+            if (!detail::simd_find_value_in_range<V>(value)) {
+                return 0;
+            }
+            return detail::simd_count(first, last, static_cast<V>(value));
         }
-    };
+
+        return count_fn::impl(first, last, value, proj, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename T, typename Proj>
+    static constexpr auto range_impl(Rng& rng, const T& value, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iter_difference_t<iterator_t<Rng>>>
+    {
+        const auto ptr = nano::data(rng);
+        return count_fn::impl(ptr, ptr + nano::size(rng), value, proj,
+                              priority_tag<1>{});
+    }
+
+    template <typename Rng, typename T, typename Proj>
+    static constexpr iter_difference_t<iterator_t<Rng>>
+    range_impl(Rng& rng, const T& value, Proj& proj, priority_tag<0>)
+    {
+        return count_fn::impl(nano::begin(rng), nano::end(rng), value, proj,
+                              priority_tag<1>{});
+    }
 
 public:
     template <typename I, typename S, typename T, typename Proj = identity>
@@ -85,9 +125,8 @@ public:
         iter_difference_t<I>>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = equal_to_pred<T>{value};
-        return count_if_fn::impl(std::move(first), std::move(last),
-                                 pred, proj);
+        return count_fn::impl(std::move(first), std::move(last), value, proj,
+                              priority_tag<1>{});
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -98,9 +137,7 @@ public:
         iter_difference_t<iterator_t<Rng>>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        const auto pred = equal_to_pred<T>{value};
-        return count_if_fn::impl(nano::begin(rng), nano::end(rng),
-                                 pred, proj);
+        return count_fn::range_impl(rng, value, proj, priority_tag<1>{});
     }
 };
 
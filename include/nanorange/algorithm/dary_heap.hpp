@@ -0,0 +1,287 @@
+// nanorange/algorithm/dary_heap.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_DARY_HEAP_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_DARY_HEAP_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/heap_sift.hpp>
+#include <nanorange/ranges.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// nano::make_dary_heap<D>, push_dary_heap<D>, pop_dary_heap<D>,
+// sort_dary_heap<D>, is_dary_heap<D> and is_dary_heap_until<D>
+// (extensions)
+//
+// Versions of the heap algorithms in which each element has D children
+// rather than two: the children of the element at position i are at
+// positions D * i + 1, ..., D * i + D. The heap is shallower by a factor of
+// log2(D), and the children of each element are adjacent in memory, so on
+// large heaps sifting an element down touches fewer cache lines, at the cost
+// of more comparisons per level. A 2-ary heap is the same as an ordinary one.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+template <int D>
+struct sort_dary_heap_fn;
+
+template <int D>
+struct is_dary_heap_fn;
+
+template <int D>
+struct make_dary_heap_fn {
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+
+private:
+    friend struct sort_dary_heap_fn<D>;
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        if (n > 1) {
+            // start from the last element with children
+            for (auto start = (n - 2) / D; start >= 0; --start) {
+                detail::dary_sift_down_n<D>(first, n, start, comp, proj);
+            }
+        }
+
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> && Sentinel<S, I> && Sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return make_dary_heap_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<RandomAccessRange<Rng> &&
+                                   Sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return make_dary_heap_fn::impl(nano::begin(rng), nano::distance(rng),
+                                       comp, proj);
+    }
+};
+
+template <int D>
+struct push_dary_heap_fn {
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+
+private:
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        detail::dary_sift_up_n<D>(first, n, comp, proj);
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> && Sentinel<S, I> && Sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return push_dary_heap_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<RandomAccessRange<Rng> &&
+                                   Sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return push_dary_heap_fn::impl(nano::begin(rng), nano::distance(rng),
+                                       comp, proj);
+    }
+};
+
+template <int D>
+struct pop_dary_heap_fn {
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+
+private:
+    friend struct sort_dary_heap_fn<D>;
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        if (n > 1) {
+            nano::iter_swap(first, first + (n - 1));
+            detail::dary_sift_down_n<D>(first, n - 1, iter_difference_t<I>{0},
+                                        comp, proj);
+        }
+
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> && Sentinel<S, I> && Sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return pop_dary_heap_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<RandomAccessRange<Rng> &&
+                                   Sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return pop_dary_heap_fn::impl(nano::begin(rng), nano::distance(rng),
+                                      comp, proj);
+    }
+};
+
+template <int D>
+struct sort_dary_heap_fn {
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+
+private:
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        for (auto i = n; i > 1; --i) {
+            pop_dary_heap_fn<D>::impl(first, i, comp, proj);
+        }
+
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> && Sentinel<S, I> && Sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return sort_dary_heap_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<RandomAccessRange<Rng> &&
+                                   Sortable<iterator_t<Rng>, Comp, Proj>,
+                               safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return sort_dary_heap_fn::impl(nano::begin(rng), nano::distance(rng),
+                                       comp, proj);
+    }
+};
+
+template <int D>
+struct is_dary_heap_until_fn {
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+
+private:
+    friend struct is_dary_heap_fn<D>;
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
+                            Proj& proj)
+    {
+        iter_difference_t<I> parent = 0;
+        iter_difference_t<I> child = 1;
+
+        for (; child < n; ++parent) {
+            for (int i = 0; i < D && child < n; ++i, ++child) {
+                if (nano::invoke(comp, nano::invoke(proj, *(first + parent)),
+                                 nano::invoke(proj, *(first + child)))) {
+                    return first + child;
+                }
+            }
+        }
+
+        return first + n;
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> && Sentinel<S, I> &&
+            IndirectStrictWeakOrder<Comp, projected<I, Proj>>,
+        I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return is_dary_heap_until_fn::impl(std::move(first), n, comp, proj);
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessRange<Rng> &&
+            IndirectStrictWeakOrder<Comp, projected<iterator_t<Rng>, Proj>>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return is_dary_heap_until_fn::impl(nano::begin(rng),
+                                           nano::distance(rng), comp, proj);
+    }
+};
+
+template <int D>
+struct is_dary_heap_fn {
+    static_assert(D >= 2, "a d-ary heap needs at least two children per node");
+
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> && Sentinel<S, I> &&
+            IndirectStrictWeakOrder<Comp, projected<I, Proj>>,
+        bool>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto n = nano::distance(first, last);
+        return is_dary_heap_until_fn<D>::impl(first, n, comp, proj) ==
+               first + n;
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessRange<Rng> &&
+            IndirectStrictWeakOrder<Comp, projected<iterator_t<Rng>, Proj>>,
+        bool>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return is_dary_heap_until_fn<D>::impl(nano::begin(rng),
+                                              nano::distance(rng), comp,
+                                              proj) == nano::end(rng);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR_TEMPLATE(int D, detail::make_dary_heap_fn<D>, make_dary_heap)
+NANO_INLINE_VAR_TEMPLATE(int D, detail::push_dary_heap_fn<D>, push_dary_heap)
+NANO_INLINE_VAR_TEMPLATE(int D, detail::pop_dary_heap_fn<D>, pop_dary_heap)
+NANO_INLINE_VAR_TEMPLATE(int D, detail::sort_dary_heap_fn<D>, sort_dary_heap)
+NANO_INLINE_VAR_TEMPLATE(int D, detail::is_dary_heap_until_fn<D>,
+                         is_dary_heap_until)
+NANO_INLINE_VAR_TEMPLATE(int D, detail::is_dary_heap_fn<D>, is_dary_heap)
+
+NANO_END_NAMESPACE
+
+#endif
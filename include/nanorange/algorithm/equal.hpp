@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_EQUAL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_EQUAL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find.hpp>
 #include <nanorange/iterator/operations.hpp>
 #include <nanorange/ranges.hpp>
 
@@ -36,7 +37,7 @@ private:
     template <typename I1, typename S1, typename I2, typename Pred,
               typename Proj1, typename Proj2>
     static constexpr bool impl3(I1 first1, S1 last1, I2 first2, Pred pred,
-                                Proj1 proj1, Proj2 proj2)
+                                Proj1 proj1, Proj2 proj2, priority_tag<0>)
     {
         while (first1 != last1) {
             if (!nano::invoke(pred, nano::invoke(proj1, *first1),
@@ -50,6 +51,49 @@ private:
         return true;
     }
 
+    // Contiguous ranges of built-in types can be compared using memcmp
+    template <typename T1, typename T2, typename Pred>
+    static constexpr std::enable_if_t<simd_equal_comparable<T1, T2, Pred>, bool>
+    impl3(T1* first1, T1* last1, T2* first2, Pred pred, identity proj1,
+          identity proj2, priority_tag<1>)
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::simd_equal(first1, first2, last1 - first1);
+        }
+
+        return equal_fn::impl3(first1, last1, first2, std::move(pred),
+                               proj1, proj2, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr auto range_impl3(Rng1& rng1, Rng2& rng2, Pred& pred,
+                                      Proj1& proj1, Proj2& proj2,
+                                      priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && ContiguousRange<Rng2>,
+                            bool>
+    {
+        const auto ptr1 = nano::data(rng1);
+        return equal_fn::impl3(ptr1, ptr1 + nano::size(rng1),
+                               nano::data(rng2), std::move(pred),
+                               std::move(proj1), std::move(proj2),
+                               priority_tag<1>{});
+    }
+
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr bool range_impl3(Rng1& rng1, Rng2& rng2, Pred& pred,
+                                      Proj1& proj1, Proj2& proj2,
+                                      priority_tag<0>)
+    {
+        return equal_fn::impl3(nano::begin(rng1), nano::end(rng1),
+                               nano::begin(rng2), std::move(pred),
+                               std::move(proj1), std::move(proj2),
+                               priority_tag<1>{});
+    }
+
 public:
     // Four-legged, sized sentinels
     template <typename I1, typename S1, typename I2, typename S2,
@@ -72,7 +116,8 @@ public:
         // and save ourselves a comparison
         return equal_fn::impl3(std::move(first1), std::move(last1),
                                std::move(first2), std::move(pred),
-                               std::move(proj1), std::move(proj2));
+                               std::move(proj1), std::move(proj2),
+                               priority_tag<1>{});
     }
 
     // Four-legged, unsized sentinels
@@ -107,7 +152,8 @@ public:
     {
         return equal_fn::impl3(std::move(first1), std::move(last1),
                                std::forward<I2>(first2), std::move(pred),
-                               std::move(proj1), std::move(proj2));
+                               std::move(proj1), std::move(proj2),
+                               priority_tag<1>{});
     }
 
     // Two ranges, both sized
@@ -126,9 +172,8 @@ public:
             return false;
         }
 
-        return equal_fn::impl3(nano::begin(rng1), nano::end(rng1),
-                               nano::begin(rng2), std::move(pred),
-                               std::move(proj1), std::move(proj2));
+        return equal_fn::range_impl3(rng1, rng2, pred, proj1, proj2,
+                                     priority_tag<1>{});
     }
 
     // Two ranges, not both sized
@@ -162,7 +207,8 @@ public:
     {
         return equal_fn::impl3(nano::begin(rng1), nano::end(rng1),
                                std::forward<I2>(first2), std::move(pred),
-                               std::move(proj1), std::move(proj2));
+                               std::move(proj1), std::move(proj2),
+                               priority_tag<1>{});
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FILL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FILL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/memmove.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -16,7 +17,7 @@ namespace detail {
 struct fill_fn {
 private:
     template <typename T, typename O, typename S>
-    static constexpr O impl(O first, S last, const T& value)
+    static constexpr O impl(O first, S last, const T& value, priority_tag<0>)
     {
         while (first != last) {
             *first = value;
@@ -26,19 +27,55 @@ private:
         return first;
     }
 
+    // Contiguous ranges of scalars can be filled using memset or, if they
+    // are large, non-temporal stores
+    template <typename T, typename E>
+    static constexpr auto impl(E* first, E* last, const T& value,
+                               priority_tag<1>)
+        -> std::enable_if_t<bulk_fillable<E, T>, E*>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::bulk_fill(first, last - first, value);
+        }
+
+        return fill_fn::impl(first, last, value, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename T, typename Rng>
+    static constexpr auto range_impl(Rng& rng, const T& value, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        fill_fn::impl(ptr, ptr + n, value, priority_tag<1>{});
+        return nano::begin(rng) + n;
+    }
+
+    template <typename T, typename Rng>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, const T& value,
+                                                priority_tag<0>)
+    {
+        return fill_fn::impl(nano::begin(rng), nano::end(rng), value,
+                             priority_tag<1>{});
+    }
+
 public:
     template <typename T, typename O, typename S>
     constexpr std::enable_if_t<OutputIterator<O, const T&> && Sentinel<S, O>, O>
     operator()(O first, S last, const T& value) const
     {
-        return fill_fn::impl(std::move(first), std::move(last), value);
+        return fill_fn::impl(std::move(first), std::move(last), value,
+                             priority_tag<1>{});
     }
 
     template <typename T, typename Rng>
     constexpr std::enable_if_t<OutputRange<Rng, const T&>, safe_iterator_t<Rng>>
     operator()(Rng&& rng, const T& value) const
     {
-        return fill_fn::impl(nano::begin(rng), nano::end(rng), value);
+        return fill_fn::range_impl(rng, value, priority_tag<1>{});
     }
 };
 
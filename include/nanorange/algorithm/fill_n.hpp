@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FILL_N_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FILL_N_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/memmove.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -14,15 +15,38 @@ NANO_BEGIN_NAMESPACE
 namespace detail {
 
 struct fill_n_fn {
+private:
     template <typename T, typename O>
-    constexpr std::enable_if_t<OutputIterator<O, const T&>, O>
-    operator()(O first, iter_difference_t<O> n, const T& value) const
+    static constexpr O impl(O first, iter_difference_t<O> n, const T& value,
+                            priority_tag<0>)
     {
         for (iter_difference_t<O> i{0}; i < n; ++i, ++first) {
             *first = value;
         }
         return first;
     }
+
+    // Contiguous ranges of scalars can be filled using memset or, if they
+    // are large, non-temporal stores
+    template <typename T, typename E>
+    static constexpr auto impl(E* first, std::ptrdiff_t n, const T& value,
+                               priority_tag<1>)
+        -> std::enable_if_t<bulk_fillable<E, T>, E*>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::bulk_fill(first, n, value);
+        }
+
+        return fill_n_fn::impl(first, n, value, priority_tag<0>{});
+    }
+
+public:
+    template <typename T, typename O>
+    constexpr std::enable_if_t<OutputIterator<O, const T&>, O>
+    operator()(O first, iter_difference_t<O> n, const T& value) const
+    {
+        return fill_n_fn::impl(std::move(first), n, value, priority_tag<1>{});
+    }
 };
 
 } // namespace detail
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FIND_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FIND_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -63,16 +64,55 @@ namespace detail {
 
 struct find_fn {
 private:
-    template <typename ValueType>
-    struct equal_to_pred {
-        const ValueType& val;
+    template <typename I, typename S, typename T, typename Proj>
+    static constexpr I impl(I first, S last, const T& value, Proj& proj,
+                            priority_tag<0>)
+    {
+        return find_if_fn::impl(std::move(first), std::move(last),
+                                equal_to_pred<T>{value}, std::move(proj));
+    }
 
-        template <typename T>
-        constexpr bool operator()(const T& t) const
-        {
-            return t == val;
+    // Contiguous ranges of built-in types can be searched using memchr, or
+    // sixteen bytes at a time
+    template <typename E, typename T>
+    static constexpr auto impl(E* first, E* last, const T& value,
+                               identity& proj, priority_tag<1>)
+        -> std::enable_if_t<simd_findable<std::remove_const_t<E>, T>, E*>
+    {
+        using V = std::remove_const_t<E>;
+
+        if (!detail::is_constant_evaluated()) {
+            // No element can compare equal to a value which fails this
+            if (!detail::simd_find_value_in_range<V>(value)) {
+                return last;
+            }
+            return detail::simd_find(first, last, static_cast<V>(value));
         }
-    };
+
+        return find_fn::impl(first, last, value, proj, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename T, typename Proj>
+    static constexpr auto range_impl(Rng& rng, const T& value, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos = find_fn::impl(ptr, ptr + nano::size(rng), value, proj,
+                                       priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename T, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, const T& value,
+                                                Proj& proj, priority_tag<0>)
+    {
+        return find_fn::impl(nano::begin(rng), nano::end(rng), value, proj,
+                             priority_tag<1>{});
+    }
 
 public:
     template <typename I, typename S, typename T, typename Proj = identity>
@@ -82,8 +122,8 @@ public:
         I>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        return find_if_fn::impl(std::move(first), std::move(last),
-                                equal_to_pred<T>{value}, std::move(proj));
+        return find_fn::impl(std::move(first), std::move(last), value, proj,
+                             priority_tag<1>{});
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -94,8 +134,7 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        return find_if_fn::impl(nano::begin(rng), nano::end(rng),
-                                equal_to_pred<T>{value}, std::move(proj));
+        return find_fn::range_impl(rng, value, proj, priority_tag<1>{});
     }
 };
 } // namespace detail
@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/search.hpp>
+#include <nanorange/detail/algorithm/simd_search.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -18,14 +19,13 @@ namespace detail {
 
 // FIXME: Update to P0896R2 (subrange, second projection)
 
-// TODO: For BiDir iterators, we can be smarter and search backwards
 struct find_end_fn {
 private:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Pred, typename Proj1, typename Proj2>
     static constexpr subrange<I1>
     impl(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
-         Proj2& proj2)
+         Proj2& proj2, priority_tag<0>)
     {
         if (first2 == last2) {
             auto last_it = nano::next(first1, last1);
@@ -48,6 +48,96 @@ private:
         }
     }
 
+    // With bidirectional iterators, we can search backwards from the end of
+    // the first range, and stop at the first match we find, rather than
+    // finding every match from the front
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Pred, typename Proj1, typename Proj2>
+    static constexpr std::enable_if_t<BidirectionalIterator<I1> &&
+                                      BidirectionalIterator<I2>, subrange<I1>>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
+         Proj2& proj2, priority_tag<1>)
+    {
+        const I1 last1_it = nano::next(first1, last1);
+        const I2 last2_it = nano::next(first2, last2);
+
+        if (first2 == last2_it) {
+            return {last1_it, last1_it};
+        }
+
+        const I2 back2 = nano::prev(last2_it);
+
+        // Try each position for the end of the match, from the back
+        for (I1 end1 = last1_it; end1 != first1; --end1) {
+            I1 it1 = nano::prev(end1);
+            I2 it2 = back2;
+
+            while (nano::invoke(pred, nano::invoke(proj1, *it1),
+                                nano::invoke(proj2, *it2))) {
+                if (it2 == first2) {
+                    return {std::move(it1), std::move(end1)};
+                }
+                if (it1 == first1) {
+                    // There is no room for a match any further forward
+                    return {last1_it, last1_it};
+                }
+                --it1;
+                --it2;
+            }
+        }
+
+        return {last1_it, last1_it};
+    }
+
+    // Contiguous ranges of characters can be searched sixteen positions at
+    // a time
+    template <typename T1, typename T2, typename Pred>
+    static constexpr auto impl(T1* first1, T1* last1, T2* first2, T2* last2,
+                               Pred& pred, identity& proj1, identity& proj2,
+                               priority_tag<2>)
+        -> std::enable_if_t<simd_searchable<T1, T2, Pred>, subrange<T1*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            T1* const pos =
+                detail::simd_search_last(first1, last1, first2, last2);
+            return {pos, pos == last1 ? last1 : pos + (last2 - first2)};
+        }
+
+        return find_end_fn::impl(first1, last1, first2, last2, pred, proj1,
+                                 proj2, priority_tag<1>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr auto range_impl(Rng1& rng1, Rng2& rng2, Pred& pred,
+                                     Proj1& proj1, Proj2& proj2,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && SizedRange<Rng1> &&
+                            ContiguousRange<Rng2> && SizedRange<Rng2>,
+                            subrange<iterator_t<Rng1>>>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto ptr2 = nano::data(rng2);
+        const auto res = find_end_fn::impl(
+            ptr1, ptr1 + nano::size(rng1), ptr2, ptr2 + nano::size(rng2), pred,
+            proj1, proj2, priority_tag<2>{});
+        const auto first = nano::begin(rng1);
+        return {first + (res.begin() - ptr1), first + (res.end() - ptr1)};
+    }
+
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr subrange<iterator_t<Rng1>>
+    range_impl(Rng1& rng1, Rng2& rng2, Pred& pred, Proj1& proj1, Proj2& proj2,
+               priority_tag<0>)
+    {
+        return find_end_fn::impl(nano::begin(rng1), nano::end(rng1),
+                                 nano::begin(rng2), nano::end(rng2),
+                                 pred, proj1, proj2, priority_tag<2>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
             typename Pred = equal_to<>, typename Proj1 = identity,
@@ -64,7 +154,7 @@ public:
     {
         return find_end_fn::impl(std::move(first1), std::move(last1),
                                  std::move(first2), std::move(last2),
-                                 pred, proj1, proj2);
+                                 pred, proj1, proj2, priority_tag<2>{});
     }
 
     template <typename Rng1, typename Rng2, typename Pred = equal_to<>,
@@ -77,9 +167,8 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return find_end_fn::impl(nano::begin(rng1), nano::end(rng1),
-                                 nano::begin(rng2), nano::end(rng2),
-                                 pred, proj1, proj2);
+        return find_end_fn::range_impl(rng1, rng2, pred, proj1, proj2,
+                                       priority_tag<1>{});
     }
 
 };
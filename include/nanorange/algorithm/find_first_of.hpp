@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_FIND_FIRST_OF_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_FIND_FIRST_OF_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find_first_of.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -20,7 +21,8 @@ private:
     template <typename I1, typename S1, typename I2, typename S2, typename Pred,
               typename Proj1, typename Proj2>
     static constexpr I1 impl(I1 first1, S1 last1, I2 first2, S2 last2,
-                             Pred pred, Proj1 proj1, Proj2 proj2)
+                             Pred pred, Proj1 proj1, Proj2 proj2,
+                             priority_tag<0>)
     {
         for (; first1 != last1; ++first1) {
             for (I2 it = first2; it != last2; ++it) {
@@ -34,6 +36,76 @@ private:
         return first1;
     }
 
+    // When looking for any of a set of bytes, we can make a table of them,
+    // and then look up each element of the first range in linear time
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Pred>
+    static constexpr std::enable_if_t<
+        byte_set_searchable<iter_value_t<I1>, iter_value_t<I2>, Pred>, I1>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, Pred, identity,
+         identity, priority_tag<1>)
+    {
+        const byte_set set =
+            detail::make_byte_set(std::move(first2), std::move(last2));
+
+        for (; first1 != last1; ++first1) {
+            if (set.contains[static_cast<unsigned char>(*first1)]) {
+                break;
+            }
+        }
+
+        return first1;
+    }
+
+    // ...and contiguous ranges can then be scanned sixteen bytes at a time
+    template <typename T1, typename I2, typename S2, typename Pred>
+    static constexpr std::enable_if_t<
+        byte_set_searchable<std::remove_const_t<T1>, iter_value_t<I2>, Pred>,
+        T1*>
+    impl(T1* first1, T1* last1, I2 first2, S2 last2, Pred pred,
+         identity proj1, identity proj2, priority_tag<2>)
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::simd_find_first_of(
+                first1, last1,
+                detail::make_byte_set(std::move(first2), std::move(last2)));
+        }
+
+        return find_first_of_fn::impl(first1, last1, std::move(first2),
+                                      std::move(last2), pred, proj1, proj2,
+                                      priority_tag<1>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename I2, typename S2, typename Pred,
+              typename Proj1, typename Proj2>
+    static constexpr auto range_impl(Rng1& rng1, I2 first2, S2 last2,
+                                     Pred& pred, Proj1& proj1, Proj2& proj2,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && SizedRange<Rng1>,
+                            iterator_t<Rng1>>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto pos = find_first_of_fn::impl(
+            ptr1, ptr1 + nano::size(rng1), std::move(first2), std::move(last2),
+            std::move(pred), std::move(proj1), std::move(proj2),
+            priority_tag<2>{});
+        return nano::begin(rng1) + (pos - ptr1);
+    }
+
+    template <typename Rng1, typename I2, typename S2, typename Pred,
+              typename Proj1, typename Proj2>
+    static constexpr iterator_t<Rng1>
+    range_impl(Rng1& rng1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
+               Proj2& proj2, priority_tag<0>)
+    {
+        return find_first_of_fn::impl(nano::begin(rng1), nano::end(rng1),
+                                      std::move(first2), std::move(last2),
+                                      std::move(pred), std::move(proj1),
+                                      std::move(proj2), priority_tag<2>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Proj1 = identity, typename Proj2 = identity,
@@ -49,7 +121,7 @@ public:
         return find_first_of_fn::impl(std::move(first1), std::move(last1),
                                       std::move(first2), std::move(last2),
                                       std::move(pred), std::move(proj1),
-                                      std::move(proj2));
+                                      std::move(proj2), priority_tag<2>{});
     }
 
     template <typename Rng1, typename Rng2, typename Proj1 = identity,
@@ -62,10 +134,9 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return find_first_of_fn::impl(nano::begin(rng1), nano::end(rng1),
-                                      nano::begin(rng2), nano::end(rng2),
-                                      std::move(pred), std::move(proj1),
-                                      std::move(proj2));
+        return find_first_of_fn::range_impl(rng1, nano::begin(rng2),
+                                            nano::end(rng2), pred, proj1,
+                                            proj2, priority_tag<1>{});
     }
 };
 
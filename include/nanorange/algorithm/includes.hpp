@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_INCLUDES_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_INCLUDES_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/gallop.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -17,8 +18,9 @@ struct includes_fn {
 private:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Comp, typename Proj1, typename Proj2>
-     static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
-                                Comp& comp, Proj1& proj1, Proj2& proj2)
+    static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
+                               Comp& comp, Proj1& proj1, Proj2& proj2,
+                               priority_tag<0>)
     {
         while (first2 != last2) {
             // If range1 is done but we still have elements in range2, then
@@ -48,6 +50,54 @@ private:
         return true;
     }
 
+    // With random-access inputs, we can gallop over long runs of elements
+    // of range1 which are not in range2 (see detail/algorithm/gallop.hpp)
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr std::enable_if_t<gallopable<I1, S1, I2, S2>, bool>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, Comp& comp, Proj1& proj1,
+         Proj2& proj2, priority_tag<1>)
+    {
+        int run1 = 0;
+        // Whether the probe which ended a gallop has already shown that the
+        // current element of range1 is not less than that of range2
+        bool not_less1 = false;
+
+        while (first2 != last2) {
+            if (first1 == last1) {
+                return false;
+            }
+
+            if (nano::invoke(comp, nano::invoke(proj2, *first2),
+                             nano::invoke(proj1, *first1))) {
+                return false;
+            }
+
+            if (not_less1 ||
+                !nano::invoke(comp, nano::invoke(proj1, *first1),
+                              nano::invoke(proj2, *first2))) {
+                ++first1;
+                ++first2;
+                run1 = 0;
+                not_less1 = false;
+            } else {
+                ++first1;
+
+                if (++run1 >= min_gallop) {
+                    // Skip the rest of the elements from range1 which are
+                    // less than the current element from range2
+                    first1 += detail::gallop_lower_bound(
+                        first1, last1 - first1, nano::invoke(proj2, *first2),
+                        comp, proj1);
+                    run1 = 0;
+                    not_less1 = true;
+                }
+            }
+        }
+
+        return true;
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Comp = less<>, typename Proj1 = identity, typename Proj2 = identity>
@@ -63,7 +113,7 @@ public:
     {
         return includes_fn::impl(std::move(first1), std::move(last1),
                                  std::move(first2), std::move(last2),
-                                 comp, proj1, proj2);
+                                 comp, proj1, proj2, priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2, typename Comp = less<>,
@@ -80,7 +130,7 @@ public:
     {
         return includes_fn::impl(nano::begin(rng1), nano::end(rng1),
                                  nano::begin(rng2), nano::end(rng2),
-                                 comp, proj1, proj2);
+                                 comp, proj1, proj2, priority_tag<1>{});
     }
 };
 
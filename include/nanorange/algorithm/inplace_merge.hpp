@@ -0,0 +1,119 @@
+// nanorange/algorithm/inplace_merge.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_INPLACE_MERGE_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_INPLACE_MERGE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/merge_adaptive.hpp>
+#include <nanorange/detail/memory/temporary_buffer.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct inplace_merge_fn {
+private:
+    template <typename I, typename Comp, typename Proj>
+    static void impl(I first, I middle, I last, Comp& comp, Proj& proj)
+    {
+        const iter_difference_t<I> len1 = nano::distance(first, middle);
+        const iter_difference_t<I> len2 = nano::distance(middle, last);
+
+        if (len1 == 0 || len2 == 0) {
+            return;
+        }
+
+        // We only need room for the shorter of the two ranges
+        temporary_buffer<iter_value_t<I>> buf(
+            static_cast<std::ptrdiff_t>(len1 < len2 ? len1 : len2), first);
+        detail::merge_adaptive(std::move(first), std::move(middle),
+                               std::move(last), len1, len2, buf.begin(),
+                               buf.size(), comp, proj);
+    }
+
+    template <typename I, typename Buf, typename Comp, typename Proj>
+    static constexpr void impl(I first, I middle, I last, Buf& buf, Comp& comp,
+                               Proj& proj)
+    {
+        const iter_difference_t<I> len1 = nano::distance(first, middle);
+        const iter_difference_t<I> len2 = nano::distance(middle, last);
+        detail::merge_adaptive(std::move(first), std::move(middle),
+                               std::move(last), len1, len2, nano::begin(buf),
+                               nano::distance(buf), comp, proj);
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        BidirectionalIterator<I> &&
+        Sentinel<S, I> &&
+        Sortable<I, Comp, Proj>, I>
+    operator()(I first, I middle, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(middle, std::move(last));
+        inplace_merge_fn::impl(std::move(first), std::move(middle), last_it,
+                               comp, proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        BidirectionalRange<Rng> &&
+        Sortable<iterator_t<Rng>, Comp, Proj>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, iterator_t<Rng> middle, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(middle, nano::end(rng));
+        inplace_merge_fn::impl(nano::begin(rng), std::move(middle), last_it,
+                               comp, proj);
+        return last_it;
+    }
+
+    // Extension: use the RandomAccessRange buf as scratch space, rather than
+    // allocating a temporary buffer
+    template <typename I, typename S, typename Buf, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        BidirectionalIterator<I> &&
+        Sentinel<S, I> &&
+        ScratchBuffer<I, Buf> &&
+        Sortable<I, Comp, Proj>, I>
+    operator()(I first, I middle, S last, Buf&& buf, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(middle, std::move(last));
+        inplace_merge_fn::impl(std::move(first), std::move(middle), last_it,
+                               buf, comp, proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Buf, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        BidirectionalRange<Rng> &&
+        ScratchBuffer<iterator_t<Rng>, Buf> &&
+        Sortable<iterator_t<Rng>, Comp, Proj>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, iterator_t<Rng> middle, Buf&& buf,
+               Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(middle, nano::end(rng));
+        inplace_merge_fn::impl(nano::begin(rng), std::move(middle), last_it,
+                               buf, comp, proj);
+        return last_it;
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::inplace_merge_fn, inplace_merge)
+
+NANO_END_NAMESPACE
+
+#endif
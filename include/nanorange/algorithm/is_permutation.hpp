@@ -102,7 +102,7 @@ private:
         // Strip equal prefixes from both ranges
         auto result = mismatch_fn::impl4(std::move(first1), last1,
                                          std::move(first2), last2,
-                                         pred, proj1, proj2);
+                                         pred, proj1, proj2, priority_tag<1>{});
         first1 = std::move(result).in1;
         first2 = std::move(result).in2;
 
@@ -22,8 +22,8 @@ struct is_sorted_fn {
         IndirectStrictWeakOrder<Comp, projected<I, Proj>>, bool>
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return is_sorted_until_fn::impl(std::move(first), last,
-                                        comp, proj) == last;
+        return is_sorted_until_fn::impl(std::move(first), last, comp, proj,
+                                        priority_tag<1>{}) == last;
     }
 
     template <typename Rng, typename Comp = less<>, typename Proj = identity>
@@ -33,8 +33,9 @@ struct is_sorted_fn {
         bool>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return is_sorted_until_fn::impl(nano::begin(rng), nano::end(rng),
-                                        comp, proj) == nano::end(rng);
+        return is_sorted_until_fn::range_impl(rng, comp, proj,
+                                              priority_tag<1>{}) ==
+               nano::end(rng);
     }
 };
 
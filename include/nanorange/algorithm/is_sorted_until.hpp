@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_IS_SORTED_UNTIL_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_IS_SORTED_UNTIL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_reduce.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -18,7 +19,8 @@ private:
     friend struct is_sorted_fn;
 
     template <typename I, typename S, typename Comp, typename Proj>
-    static constexpr I impl(I first, S last, Comp& comp, Proj& proj)
+    static constexpr I impl(I first, S last, Comp& comp, Proj& proj,
+                            priority_tag<0>)
     {
         if (first == last) {
             return first;
@@ -38,6 +40,44 @@ private:
         return n;
     }
 
+    // Contiguous ranges of arithmetic types compared using < can be checked
+    // sixteen bytes at a time
+    template <typename T, typename Comp, typename Proj>
+    static constexpr auto impl(T* first, T* last, Comp& comp, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<simd_orderable<T, Comp, Proj>, T*>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::simd_is_sorted_until(first, last);
+        }
+
+        return is_sorted_until_fn::impl(first, last, comp, proj,
+                                        priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr auto range_impl(Rng& rng, Comp& comp, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos =
+            is_sorted_until_fn::impl(ptr, ptr + nano::size(rng), comp, proj,
+                                     priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, Comp& comp,
+                                                Proj& proj, priority_tag<0>)
+    {
+        return is_sorted_until_fn::impl(nano::begin(rng), nano::end(rng), comp,
+                                        proj, priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename Comp = less<>,
               typename Proj = identity>
@@ -48,7 +88,7 @@ public:
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         return is_sorted_until_fn::impl(std::move(first), std::move(last),
-                                        comp, proj);
+                                        comp, proj, priority_tag<1>{});
     }
 
     template <typename Rng, typename Comp = less<>, typename Proj = identity>
@@ -58,8 +98,8 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return is_sorted_until_fn::impl(nano::begin(rng), nano::end(rng),
-                                        comp, proj);
+        return is_sorted_until_fn::range_impl(rng, comp, proj,
+                                              priority_tag<1>{});
     }
 };
 
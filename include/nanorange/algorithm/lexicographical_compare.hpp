@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_LEXICOGRAPHICAL_COMPARE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find.hpp>
 #include <nanorange/ranges.hpp>
 
 
@@ -21,7 +22,8 @@ private:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Comp, typename Proj1, typename Proj2>
     static constexpr bool impl(I1 first1, S1 last1, I2 first2, S2 last2,
-                                Comp& comp, Proj1& proj1, Proj2& proj2)
+                                Comp& comp, Proj1& proj1, Proj2& proj2,
+                                priority_tag<0>)
     {
         while (first1 != last1 && first2 != last2) {
             if (nano::invoke(comp, nano::invoke(proj1, *first1),
@@ -38,6 +40,54 @@ private:
         return first1 == last1 && first2 != last2;
     }
 
+    // Contiguous ranges of integers can be compared using memcmp, or by
+    // finding the first mismatch sixteen bytes at a time
+    template <typename T1, typename T2, typename Comp>
+    static constexpr auto impl(T1* first1, T1* last1, T2* first2, T2* last2,
+                               Comp& comp, identity& proj1, identity& proj2,
+                               priority_tag<1>)
+        -> std::enable_if_t<simd_lexicographically_comparable<T1, T2, Comp>,
+                            bool>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::simd_lexicographical_compare(first1, last1, first2,
+                                                        last2);
+        }
+
+        return lexicographical_compare_fn::impl(first1, last1, first2, last2,
+                                                comp, proj1, proj2,
+                                                priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2, typename Comp, typename Proj1,
+              typename Proj2>
+    static constexpr auto range_impl(Rng1& rng1, Rng2& rng2, Comp& comp,
+                                     Proj1& proj1, Proj2& proj2,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && SizedRange<Rng1> &&
+                            ContiguousRange<Rng2> && SizedRange<Rng2>,
+                            bool>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto ptr2 = nano::data(rng2);
+        return lexicographical_compare_fn::impl(
+            ptr1, ptr1 + nano::size(rng1), ptr2, ptr2 + nano::size(rng2), comp,
+            proj1, proj2, priority_tag<1>{});
+    }
+
+    template <typename Rng1, typename Rng2, typename Comp, typename Proj1,
+              typename Proj2>
+    static constexpr bool range_impl(Rng1& rng1, Rng2& rng2, Comp& comp,
+                                     Proj1& proj1, Proj2& proj2,
+                                     priority_tag<0>)
+    {
+        return lexicographical_compare_fn::impl(
+            nano::begin(rng1), nano::end(rng1), nano::begin(rng2),
+            nano::end(rng2), comp, proj1, proj2, priority_tag<1>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Comp = less<>, typename Proj1 = identity,
@@ -55,7 +105,7 @@ public:
         return lexicographical_compare_fn::impl(
                 std::move(first1), std::move(last1),
                 std::move(first2), std::move(last2),
-                comp, proj1, proj2);
+                comp, proj1, proj2, priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2, typename Comp = less<>,
@@ -69,10 +119,8 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Comp comp = Comp{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return lexicographical_compare_fn::impl(
-                nano::begin(rng1), nano::end(rng1),
-                nano::begin(rng2), nano::end(rng2),
-                comp, proj1, proj2);
+        return lexicographical_compare_fn::range_impl(rng1, rng2, comp, proj1,
+                                                      proj2, priority_tag<1>{});
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MAX_ELEMENT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MAX_ELEMENT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_reduce.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -14,8 +15,10 @@ NANO_BEGIN_NAMESPACE
 namespace detail {
 
 struct max_element_fn {
+private:
     template <typename I, typename S, typename Comp, typename Proj>
-    static constexpr I impl(I first, S last, Comp& comp, Proj& proj)
+    static constexpr I impl(I first, S last, Comp& comp, Proj& proj,
+                            priority_tag<0>)
     {
         if (first == last) {
             return first;
@@ -33,6 +36,43 @@ struct max_element_fn {
         return first;
     }
 
+    // Contiguous ranges of arithmetic types compared using < can be searched
+    // sixteen bytes at a time
+    template <typename T, typename Comp, typename Proj>
+    static constexpr auto impl(T* first, T* last, Comp& comp, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<simd_orderable<T, Comp, Proj>, T*>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::simd_max_element(first, last);
+        }
+
+        return max_element_fn::impl(first, last, comp, proj,
+                                    priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr auto range_impl(Rng& rng, Comp& comp, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos = max_element_fn::impl(ptr, ptr + nano::size(rng),
+                                                comp, proj, priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, Comp& comp,
+                                                Proj& proj, priority_tag<0>)
+    {
+        return max_element_fn::impl(nano::begin(rng), nano::end(rng), comp,
+                                    proj, priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename Comp = less<>,
             typename Proj = identity>
@@ -42,8 +82,8 @@ public:
     IndirectStrictWeakOrder<Comp, projected<I, Proj>>, I>
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return max_element_fn::impl(std::move(first), std::move(last),
-                                    comp, proj);
+        return max_element_fn::impl(std::move(first), std::move(last), comp,
+                                    proj, priority_tag<1>{});
     }
 
     template <typename Rng, typename Comp = less<>, typename Proj = identity>
@@ -53,8 +93,7 @@ public:
     safe_iterator_t<Rng>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return max_element_fn::impl(nano::begin(rng), nano::end(rng),
-                                    comp, proj);
+        return max_element_fn::range_impl(rng, comp, proj, priority_tag<1>{});
     }
 };
 
@@ -9,6 +9,9 @@
 
 #include <nanorange/algorithm/copy.hpp>
 #include <nanorange/algorithm/transform.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
+#include <nanorange/detail/algorithm/parallel_merge.hpp>
+#include <nanorange/execution.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -24,7 +27,7 @@ private:
               typename Comp, typename Proj1, typename Proj2>
     static constexpr merge_result<I1, I2, O>
     impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
-         Proj1& proj1, Proj2& proj2)
+         Proj1& proj1, Proj2& proj2, priority_tag<0>)
     {
         while (first1 != last1) {
             // If we've reached the end of the second range, copy any remaining
@@ -61,6 +64,111 @@ private:
         return {std::move(first1), std::move(first2),  std::move(result)};
     }
 
+    // With random-access inputs, we can gallop over long runs from either
+    // range (see detail/algorithm/gallop.hpp)
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr std::enable_if_t<gallopable<I1, S1, I2, S2>,
+                                      merge_result<I1, I2, O>>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
+         Proj1& proj1, Proj2& proj2, priority_tag<1>)
+    {
+        int run1 = 0;
+        int run2 = 0;
+        // Whether the probe which ended a gallop has already shown which
+        // range the next element comes from
+        bool known1 = false;
+        bool known2 = false;
+
+        while (first1 != last1 && first2 != last2) {
+            if (known2 ||
+                (!known1 && nano::invoke(comp, nano::invoke(proj2, *first2),
+                                         nano::invoke(proj1, *first1)))) {
+                *result = *first2;
+                ++first2;
+                ++result;
+                run1 = 0;
+                known2 = false;
+
+                // Copy the rest of the elements from range2 which are less
+                // than the current element from range1
+                if (++run2 >= min_gallop) {
+                    const auto n = detail::gallop_lower_bound(
+                        first2, last2 - first2, nano::invoke(proj1, *first1),
+                        comp, proj2);
+                    auto res = nano::copy(first2, first2 + n,
+                                          std::move(result));
+                    first2 = std::move(res.in);
+                    result = std::move(res.out);
+                    run2 = 0;
+                    known1 = true;
+                }
+            } else {
+                *result = *first1;
+                ++first1;
+                ++result;
+                run2 = 0;
+                known1 = false;
+
+                // Copy the rest of the elements from range1 which are not
+                // greater than the current element from range2
+                if (++run1 >= min_gallop) {
+                    const auto n = detail::gallop_upper_bound(
+                        first1, last1 - first1, nano::invoke(proj2, *first2),
+                        comp, proj1);
+                    auto res = nano::copy(first1, first1 + n,
+                                          std::move(result));
+                    first1 = std::move(res.in);
+                    result = std::move(res.out);
+                    run1 = 0;
+                    known2 = true;
+                }
+            }
+        }
+
+        auto res1 = nano::copy(std::move(first1), std::move(last1),
+                               std::move(result));
+        auto res2 = nano::copy(std::move(first2), std::move(last2),
+                               std::move(res1.out));
+
+        return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+    }
+
+    template <typename I1, typename I2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static merge_result<I1, I2, O>
+    impl(execution::sequenced_policy, I1 first1, I1 last1, I2 first2,
+         I2 last2, O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+    {
+        return merge_fn::impl(std::move(first1), std::move(last1),
+                              std::move(first2), std::move(last2),
+                              std::move(result), comp, proj1, proj2,
+                              priority_tag<1>{});
+    }
+
+    // Comp, Proj1 and Proj2 may be invoked concurrently from several threads
+    template <typename EP, typename I1, typename I2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static merge_result<I1, I2, O>
+    impl(EP, I1 first1, I1 last1, I2 first2, I2 last2, O result, Comp& comp,
+         Proj1& proj1, Proj2& proj2)
+    {
+        using D = common_type_t<iter_difference_t<I1>, iter_difference_t<I2>,
+                                iter_difference_t<O>>;
+        const D n1 = last1 - first1;
+        const D n2 = last2 - first2;
+
+        auto seq_merge = [&](I1 f1, I1 l1, I2 f2, I2 l2, O out) {
+            merge_fn::impl(std::move(f1), std::move(l1), std::move(f2),
+                           std::move(l2), std::move(out), comp, proj1, proj2,
+                           priority_tag<1>{});
+        };
+        detail::parallel_merge(first1, n1, first2, n2, result, comp, proj1,
+                               proj2, seq_merge, detail::parallel_fork_depth());
+
+        return {std::move(last1), std::move(last2), result + (n1 + n2)};
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp = less<>, typename Proj1 = identity,
@@ -79,7 +187,7 @@ public:
         return merge_fn::impl(std::move(first1), std::move(last1),
                               std::move(first2), std::move(last2),
                               std::move(result), comp,
-                              proj1, proj2);
+                              proj1, proj2, priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2, typename O, typename Comp = less<>,
@@ -96,7 +204,55 @@ public:
         return merge_fn::impl(nano::begin(rng1), nano::end(rng1),
                               nano::begin(rng2), nano::end(rng2),
                               std::move(result), comp,
-                              proj1, proj2);
+                              proj1, proj2, priority_tag<1>{});
+    }
+
+    // Extension: parallel merge of random-access ranges into a random-access
+    // output, which remains stable
+    template <typename ExecutionPolicy, typename I1, typename S1, typename I2,
+              typename S2, typename O, typename Comp = less<>,
+              typename Proj1 = identity, typename Proj2 = identity>
+    std::enable_if_t<
+        is_execution_policy_v<remove_cvref_t<ExecutionPolicy>> &&
+        RandomAccessIterator<I1> &&
+        SizedSentinel<S1, I1> &&
+        RandomAccessIterator<I2> &&
+        SizedSentinel<S2, I2> &&
+        RandomAccessIterator<O> &&
+        Mergeable<I1, I2, O, Comp, Proj1, Proj2>,
+        merge_result<I1, I2, O>>
+    operator()(ExecutionPolicy&& policy, I1 first1, S1 last1, I2 first2,
+               S2 last2, O result, Comp comp = Comp{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        I1 last1_it = nano::next(first1, last1);
+        I2 last2_it = nano::next(first2, last2);
+        return merge_fn::impl(policy, std::move(first1), std::move(last1_it),
+                              std::move(first2), std::move(last2_it),
+                              std::move(result), comp, proj1, proj2);
+    }
+
+    template <typename ExecutionPolicy, typename Rng1, typename Rng2,
+              typename O, typename Comp = less<>, typename Proj1 = identity,
+              typename Proj2 = identity>
+    std::enable_if_t<
+        is_execution_policy_v<remove_cvref_t<ExecutionPolicy>> &&
+        RandomAccessRange<Rng1> &&
+        SizedRange<Rng1> &&
+        RandomAccessRange<Rng2> &&
+        SizedRange<Rng2> &&
+        RandomAccessIterator<O> &&
+        Mergeable<iterator_t<Rng1>, iterator_t<Rng2>, O, Comp, Proj1, Proj2>,
+        merge_result<safe_iterator_t<Rng1>, safe_iterator_t<Rng2>, O>>
+    operator()(ExecutionPolicy&& policy, Rng1&& rng1, Rng2&& rng2, O result,
+               Comp comp = Comp{}, Proj1 proj1 = Proj1{},
+               Proj2 proj2 = Proj2{}) const
+    {
+        return merge_fn::impl(policy, nano::begin(rng1),
+                              nano::next(nano::begin(rng1), nano::end(rng1)),
+                              nano::begin(rng2),
+                              nano::next(nano::begin(rng2), nano::end(rng2)),
+                              std::move(result), comp, proj1, proj2);
     }
 };
 
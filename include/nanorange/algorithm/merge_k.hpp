@@ -0,0 +1,196 @@
+// nanorange/algorithm/merge_k.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_MERGE_K_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_MERGE_K_HPP_INCLUDED
+
+#include <nanorange/algorithm/copy.hpp>
+
+#include <cstddef>
+#include <vector>
+
+NANO_BEGIN_NAMESPACE
+
+// Extension: merges each of the sorted input ranges in the ForwardRange rngs
+// into a single sorted sequence written to the output, in one pass. As with
+// merge(), equivalent elements are written in the order of the ranges they
+// came from.
+//
+// The next element is chosen using a loser tree (Knuth, TAOCP vol. 3,
+// 5.4.1): each internal node records the range which lost the match played
+// there, so that replacing the overall winner needs only one comparison at
+// each level on the way back up, about log2(N) in all for N ranges. The
+// input ranges need only be single-pass, but they must outlive the call.
+
+template <typename I, typename O>
+using merge_k_result = copy_result<I, O>;
+
+namespace detail {
+
+template <typename Rngs>
+using merge_k_inner_t = iter_reference_t<iterator_t<Rngs>>;
+
+struct merge_k_fn {
+private:
+    // The state of the merge, for the ranges which were not empty to begin
+    // with. Each internal node of the loser tree records the range which lost
+    // the match played there, and tree[0] the overall winner. The leaf for
+    // range i is node k + i, and the parent of node n is n / 2.
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct tournament {
+        std::vector<I> firsts;
+        std::vector<S> lasts;
+        std::vector<std::size_t> tree;
+        Comp& comp;
+        Proj& proj;
+
+        bool empty(std::size_t i) const { return firsts[i] == lasts[i]; }
+
+        // Whether the head of range a should be output before that of range
+        // b. A range which has run out loses to any which has not, as though
+        // its head were greater than everything. Otherwise ties go to the
+        // range which came first: that is, the later range wins only if its
+        // head is strictly less, so a single comparison decides each match.
+        bool beats(std::size_t a, std::size_t b) const
+        {
+            if (empty(a) || empty(b)) {
+                return empty(b);
+            }
+
+            const std::size_t later = a < b ? b : a;
+            const std::size_t earlier = a < b ? a : b;
+            const bool later_wins =
+                nano::invoke(comp, nano::invoke(proj, *firsts[later]),
+                             nano::invoke(proj, *firsts[earlier]));
+            return later_wins != (a < b);
+        }
+
+        // Drops any ranges which are empty to begin with (keeping the others
+        // in order) and plays every match, with k - 1 comparisons
+        void build()
+        {
+            std::size_t k = 0;
+            for (std::size_t i = 0; i < firsts.size(); ++i) {
+                if (!empty(i)) {
+                    firsts[k] = std::move(firsts[i]);
+                    lasts[k] = std::move(lasts[i]);
+                    ++k;
+                }
+            }
+            firsts.erase(firsts.begin() + k, firsts.end());
+            lasts.erase(lasts.begin() + k, lasts.end());
+
+            std::vector<std::size_t> winners(2 * k);
+            tree.assign(k, 0);
+
+            for (std::size_t i = 0; i < k; ++i) {
+                winners[k + i] = i;
+            }
+
+            for (std::size_t n = k - 1; n > 0 && k > 1; --n) {
+                const std::size_t a = winners[2 * n];
+                const std::size_t b = winners[2 * n + 1];
+                const bool a_wins = beats(a, b);
+                winners[n] = a_wins ? a : b;
+                tree[n] = a_wins ? b : a;
+            }
+
+            if (k > 0) {
+                tree[0] = winners[1];
+            }
+        }
+
+        // Replays the matches on the path from the leaf of the winner (whose
+        // range has moved on, and may now be empty) to the root. The outcome
+        // of each match is unpredictable, so we select the new winner without
+        // branching on it.
+        void replay()
+        {
+            std::size_t winner = tree[0];
+
+            for (std::size_t n = (firsts.size() + winner) / 2; n > 0; n /= 2) {
+                const std::size_t other = tree[n];
+                const bool swap = beats(other, winner);
+                tree[n] = swap ? winner : other;
+                winner = swap ? other : winner;
+            }
+
+            tree[0] = winner;
+        }
+    };
+
+    template <typename Rngs, typename O, typename Comp, typename Proj>
+    static merge_k_result<iterator_t<Rngs>, O>
+    impl(Rngs& rngs, O out, Comp& comp, Proj& proj)
+    {
+        using inner_t = merge_k_inner_t<Rngs>;
+        using I = iterator_t<inner_t>;
+        using S = sentinel_t<inner_t>;
+
+        tournament<I, S, Comp, Proj> t{{}, {}, {}, comp, proj};
+
+        auto outer = nano::begin(rngs);
+        const auto outer_last = nano::end(rngs);
+        for (; outer != outer_last; ++outer) {
+            inner_t&& rng = *outer;
+            t.firsts.push_back(nano::begin(rng));
+            t.lasts.push_back(nano::end(rng));
+        }
+
+        t.build();
+
+        // Once a single range remains, it is the winner, and we can copy the
+        // rest of it directly
+        std::size_t remaining = t.firsts.size();
+        while (remaining > 1) {
+            const std::size_t winner = t.tree[0];
+            I& first = t.firsts[winner];
+
+            *out = *first;
+            ++out;
+            ++first;
+
+            if (first == t.lasts[winner]) {
+                --remaining;
+            }
+            t.replay();
+        }
+
+        if (remaining == 1) {
+            const std::size_t winner = t.tree[0];
+            out = nano::copy(std::move(t.firsts[winner]),
+                             std::move(t.lasts[winner]), std::move(out)).out;
+        }
+
+        return {std::move(outer), std::move(out)};
+    }
+
+public:
+    template <typename Rngs, typename O, typename Comp = less<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        ForwardRange<Rngs> &&
+        InputRange<merge_k_inner_t<Rngs>> &&
+        ForwardingRange<merge_k_inner_t<Rngs>> &&
+        WeaklyIncrementable<O> &&
+        IndirectlyCopyable<iterator_t<merge_k_inner_t<Rngs>>, O> &&
+        IndirectStrictWeakOrder<
+            Comp, projected<iterator_t<merge_k_inner_t<Rngs>>, Proj>>,
+        merge_k_result<safe_iterator_t<Rngs>, O>>
+    operator()(Rngs&& rngs, O out, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        return merge_k_fn::impl(rngs, std::move(out), comp, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::merge_k_fn, merge_k)
+
+NANO_END_NAMESPACE
+
+#endif
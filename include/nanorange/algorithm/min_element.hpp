@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MIN_ELEMENT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MIN_ELEMENT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_reduce.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -16,7 +17,8 @@ namespace detail {
 struct min_element_fn {
 private:
     template <typename I, typename S, typename Comp, typename Proj>
-    static constexpr I impl(I first, S last, Comp& comp, Proj& proj)
+    static constexpr I impl(I first, S last, Comp& comp, Proj& proj,
+                            priority_tag<0>)
     {
         if (first == last) {
             return first;
@@ -34,6 +36,43 @@ private:
         return first;
     }
 
+    // Contiguous ranges of arithmetic types compared using < can be searched
+    // sixteen bytes at a time
+    template <typename T, typename Comp, typename Proj>
+    static constexpr auto impl(T* first, T* last, Comp& comp, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<simd_orderable<T, Comp, Proj>, T*>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return detail::simd_min_element(first, last);
+        }
+
+        return min_element_fn::impl(first, last, comp, proj,
+                                    priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr auto range_impl(Rng& rng, Comp& comp, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos = min_element_fn::impl(ptr, ptr + nano::size(rng),
+                                                comp, proj, priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, Comp& comp,
+                                                Proj& proj, priority_tag<0>)
+    {
+        return min_element_fn::impl(nano::begin(rng), nano::end(rng), comp,
+                                    proj, priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename Comp = less<>,
               typename Proj = identity>
@@ -43,8 +82,8 @@ public:
         IndirectStrictWeakOrder<Comp, projected<I, Proj>>, I>
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return min_element_fn::impl(std::move(first), std::move(last),
-                                    comp, proj);
+        return min_element_fn::impl(std::move(first), std::move(last), comp,
+                                    proj, priority_tag<1>{});
     }
 
     template <typename Rng, typename Comp = less<>, typename Proj = identity>
@@ -54,8 +93,7 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return min_element_fn::impl(nano::begin(rng), nano::end(rng),
-                                    comp, proj);
+        return min_element_fn::range_impl(rng, comp, proj, priority_tag<1>{});
     }
 };
 
@@ -11,6 +11,7 @@
 #define NANORANGE_ALGORITHM_MINMAX_ELEMENT_HPP_INCLUDED
 
 #include <nanorange/algorithm/minmax.hpp>
+#include <nanorange/detail/algorithm/simd_reduce.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -19,7 +20,8 @@ namespace detail {
 struct minmax_element_fn {
 private:
     template <typename I, typename S, typename Comp, typename Proj>
-    static constexpr minmax_result<I> impl(I first, S last, Comp& comp, Proj& proj)
+    static constexpr minmax_result<I> impl(I first, S last, Comp& comp,
+                                           Proj& proj, priority_tag<0>)
     {
         minmax_result<I> result{first, first};
 
@@ -77,6 +79,47 @@ private:
         return result;
     }
 
+    // Contiguous ranges of arithmetic types compared using < can be reduced
+    // sixteen bytes at a time, unless they contain NaNs
+    template <typename T, typename Comp, typename Proj>
+    static constexpr auto impl(T* first, T* last, Comp& comp, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<simd_orderable<T, Comp, Proj>, minmax_result<T*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            minmax_result<T*> result{first, first};
+            if (detail::simd_minmax_element(first, last, result.min,
+                                            result.max)) {
+                return result;
+            }
+        }
+
+        return minmax_element_fn::impl(first, last, comp, proj,
+                                       priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr auto range_impl(Rng& rng, Comp& comp, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            minmax_result<iterator_t<Rng>>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto res = minmax_element_fn::impl(ptr, ptr + nano::size(rng),
+                                                 comp, proj, priority_tag<1>{});
+        return {nano::begin(rng) + (res.min - ptr),
+                nano::begin(rng) + (res.max - ptr)};
+    }
+
+    template <typename Rng, typename Comp, typename Proj>
+    static constexpr minmax_result<iterator_t<Rng>>
+    range_impl(Rng& rng, Comp& comp, Proj& proj, priority_tag<0>)
+    {
+        return minmax_element_fn::impl(nano::begin(rng), nano::end(rng), comp,
+                                       proj, priority_tag<1>{});
+    }
 
 public:
     template <typename I, typename S, typename Comp = less<>,
@@ -88,8 +131,8 @@ public:
         minmax_result<I>>
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return minmax_element_fn::impl(std::move(first), std::move(last),
-                                    comp, proj);
+        return minmax_element_fn::impl(std::move(first), std::move(last), comp,
+                                       proj, priority_tag<1>{});
     }
 
     template <typename Rng, typename Comp = less<>, typename Proj = identity>
@@ -99,8 +142,8 @@ public:
         minmax_result<safe_iterator_t<Rng>>>
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
-        return minmax_element_fn::impl(nano::begin(rng), nano::end(rng),
-                                       comp, proj);
+        return minmax_element_fn::range_impl(rng, comp, proj,
+                                             priority_tag<1>{});
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_MISMATCH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_MISMATCH_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_find.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -44,7 +45,7 @@ private:
               typename Proj1, typename Proj2, typename Pred>
     static constexpr mismatch_result<I1, I2>
     impl4(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred, Proj1& proj1,
-          Proj2& proj2)
+          Proj2& proj2, priority_tag<0>)
     {
         while (first1 != last1 && first2 != last2 &&
                nano::invoke(pred, nano::invoke(proj1, *first1),
@@ -56,6 +57,59 @@ private:
         return {first1, first2};
     }
 
+    // Contiguous ranges of built-in types can be compared sixteen bytes at a
+    // time
+    template <typename T1, typename T2, typename Pred>
+    static constexpr auto impl4(T1* first1, T1* last1, T2* first2, T2* last2,
+                                Pred& pred, identity& proj1, identity& proj2,
+                                priority_tag<1>)
+        -> std::enable_if_t<simd_equal_comparable<T1, T2, Pred>,
+                            mismatch_result<T1*, T2*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            const std::ptrdiff_t n1 = last1 - first1;
+            const std::ptrdiff_t n2 = last2 - first2;
+            const std::ptrdiff_t i =
+                detail::simd_mismatch(first1, first2, n1 < n2 ? n1 : n2);
+            return {first1 + i, first2 + i};
+        }
+
+        return mismatch_fn::impl4(first1, last1, first2, last2, pred, proj1,
+                                  proj2, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr auto range_impl(Rng1& rng1, Rng2& rng2, Pred& pred,
+                                     Proj1& proj1, Proj2& proj2,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && SizedRange<Rng1> &&
+                            ContiguousRange<Rng2> && SizedRange<Rng2>,
+                            mismatch_result<iterator_t<Rng1>,
+                                            iterator_t<Rng2>>>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto ptr2 = nano::data(rng2);
+        const auto res = mismatch_fn::impl4(
+            ptr1, ptr1 + nano::size(rng1), ptr2, ptr2 + nano::size(rng2), pred,
+            proj1, proj2, priority_tag<1>{});
+        return {nano::begin(rng1) + (res.in1 - ptr1),
+                nano::begin(rng2) + (res.in2 - ptr2)};
+    }
+
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr mismatch_result<iterator_t<Rng1>, iterator_t<Rng2>>
+    range_impl(Rng1& rng1, Rng2& rng2, Pred& pred, Proj1& proj1, Proj2& proj2,
+               priority_tag<0>)
+    {
+        return mismatch_fn::impl4(nano::begin(rng1), nano::end(rng1),
+                                  nano::begin(rng2), nano::end(rng2),
+                                  pred, proj1, proj2, priority_tag<1>{});
+    }
+
 public:
     // three legged
     template <typename I1, typename S1, typename I2, typename Proj1 = identity,
@@ -104,7 +158,7 @@ public:
     {
         return mismatch_fn::impl4(std::move(first1), std::move(last1),
                                   std::move(first2), std::move(last2),
-                                  pred, proj1, proj2);
+                                  pred, proj1, proj2, priority_tag<1>{});
     }
 
     // two ranges
@@ -118,9 +172,8 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return mismatch_fn::impl4(nano::begin(rng1), nano::end(rng1),
-                                  nano::begin(rng2), nano::end(rng2),
-                                  pred, proj1, proj2);
+        return mismatch_fn::range_impl(rng1, rng2, pred, proj1, proj2,
+                                       priority_tag<1>{});
     }
 };
 
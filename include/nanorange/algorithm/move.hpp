@@ -18,6 +18,20 @@ namespace detail {
 
 struct move_fn {
 private:
+    // Contiguous ranges of trivially copyable types can be moved using
+    // memmove
+    template <typename T, typename U>
+    static constexpr auto impl(T* first, T* last, U* result, priority_tag<2>)
+        -> std::enable_if_t<memmove_assignable<T*, U, true>,
+                            move_result<T*, U*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return {last, detail::memmove_copy(first, last, result)};
+        }
+
+        return move_fn::impl(first, last, result, priority_tag<1>{});
+    }
+
     template <typename I, typename S, typename O>
     static constexpr std::enable_if_t<SizedSentinel<S, I>, move_result<I, O>>
     impl(I first, S last, O result, priority_tag<1>)
@@ -46,6 +60,28 @@ private:
         return {std::move(first), std::move(result)};
     }
 
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename O>
+    static constexpr auto range_impl(Rng& rng, O result, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            move_result<iterator_t<Rng>, O>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        auto res = move_fn::impl(ptr, ptr + n, std::move(result),
+                                 priority_tag<2>{});
+        return {nano::begin(rng) + n, std::move(res.out)};
+    }
+
+    template <typename Rng, typename O>
+    static constexpr move_result<iterator_t<Rng>, O>
+    range_impl(Rng& rng, O result, priority_tag<0>)
+    {
+        return move_fn::impl(nano::begin(rng), nano::end(rng),
+                             std::move(result), priority_tag<2>{});
+    }
+
 public:
     template <typename I, typename S, typename O>
     constexpr std::enable_if_t<InputIterator<I> && Sentinel<S, I> &&
@@ -55,7 +91,7 @@ public:
     operator()(I first, S last, O result) const
     {
         return move_fn::impl(std::move(first), std::move(last),
-                             std::move(result), priority_tag<1>{});
+                             std::move(result), priority_tag<2>{});
     }
 
     template <typename Rng, typename O>
@@ -64,8 +100,7 @@ public:
                                move_result<safe_iterator_t<Rng>, O>>
     operator()(Rng&& rng, O result) const
     {
-        return move_fn::impl(nano::begin(rng), nano::end(rng),
-                             std::move(result), priority_tag<1>{});
+        return move_fn::range_impl(rng, std::move(result), priority_tag<1>{});
     }
 };
 
@@ -81,7 +116,8 @@ namespace detail {
 struct move_backward_fn {
 private:
     template <typename I, typename S, typename O>
-    static constexpr move_backward_result<I, O> impl(I first, S sent, O result)
+    static constexpr move_backward_result<I, O> impl(I first, S sent, O result,
+                                                     priority_tag<0>)
     {
         auto last = nano::next(first, std::move(sent));
         auto it = last;
@@ -93,6 +129,38 @@ private:
         return {std::move(last), std::move(result)};
     }
 
+    template <typename T, typename U>
+    static constexpr auto impl(T* first, T* last, U* result, priority_tag<1>)
+        -> std::enable_if_t<memmove_assignable<T*, U, true>,
+                            move_backward_result<T*, U*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return {last, detail::memmove_copy_backward(first, last, result)};
+        }
+
+        return move_backward_fn::impl(first, last, result, priority_tag<0>{});
+    }
+
+    template <typename Rng, typename O>
+    static constexpr auto range_impl(Rng& rng, O result, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            move_backward_result<iterator_t<Rng>, O>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        auto res = move_backward_fn::impl(ptr, ptr + n, std::move(result),
+                                          priority_tag<1>{});
+        return {nano::begin(rng) + n, std::move(res.out)};
+    }
+
+    template <typename Rng, typename O>
+    static constexpr move_backward_result<iterator_t<Rng>, O>
+    range_impl(Rng& rng, O result, priority_tag<0>)
+    {
+        return move_backward_fn::impl(nano::begin(rng), nano::end(rng),
+                                      std::move(result), priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename O>
     constexpr std::enable_if_t<BidirectionalIterator<I> && Sentinel<S, I> &&
@@ -102,7 +170,7 @@ public:
     operator()(I first, S last, O result) const
     {
         return move_backward_fn::impl(std::move(first), std::move(last),
-                                      std::move(result));
+                                      std::move(result), priority_tag<1>{});
     }
 
     template <typename Rng, typename O>
@@ -112,8 +180,8 @@ public:
                                move_backward_result<safe_iterator_t<Rng>, O>>
     operator()(Rng&& rng, O result) const
     {
-        return move_backward_fn::impl(nano::begin(rng), nano::end(rng),
-                                      std::move(result));
+        return move_backward_fn::range_impl(rng, std::move(result),
+                                            priority_tag<1>{});
     }
 };
 
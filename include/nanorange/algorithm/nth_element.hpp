@@ -0,0 +1,53 @@
+// nanorange/algorithm/nth_element.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_NTH_ELEMENT_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_NTH_ELEMENT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/introselect.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct nth_element_fn {
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> &&
+        Sentinel<S, I> &&
+        Sortable<I, Comp, Proj>, I>
+    operator()(I first, I nth, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, std::move(last));
+        detail::introselect(std::move(first), std::move(nth), last_it, comp,
+                            proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessRange<Rng> &&
+        Sortable<iterator_t<Rng>, Comp, Proj>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, iterator_t<Rng> nth, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        detail::introselect(nano::begin(rng), std::move(nth), last_it, comp,
+                            proj);
+        return last_it;
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::nth_element_fn, nth_element)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -25,18 +25,25 @@
 
 #include <nanorange/ranges.hpp>
 
+#include <memory>
+
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
+// Binary searches over more than this many bytes prefetch the possible
+// positions of their upcoming probes
+constexpr std::size_t partition_point_prefetch_threshold = 1024;
+
 struct partition_point_fn {
 private:
+    friend struct batch_lower_bound_fn;
     friend struct lower_bound_fn;
     friend struct upper_bound_fn;
 
     template <typename I, typename Pred, typename Proj>
-    static constexpr I impl_n(I first, iter_difference_t<I> n, Pred& pred,
-                              Proj& proj)
+    static constexpr std::enable_if_t<!RandomAccessIterator<I>, I>
+    impl_n(I first, iter_difference_t<I> n, Pred& pred, Proj& proj)
     {
         while (n != 0) {
             const auto half = n/2;
@@ -54,6 +61,95 @@ private:
         return first;
     }
 
+    // For random-access iterators, rather than branching on the result of
+    // each probe we keep the length of the search range fixed at each step
+    // and conditionally advance its start, which compiles to a conditional
+    // move. This costs at most one extra probe, but avoids mispredicting half
+    // of the branches. Without branch prediction to run ahead for us, on
+    // large ranges we prefetch the four positions which could be probed two
+    // steps from now ourselves (those for the next step having been
+    // prefetched last time round).
+    template <typename I, typename Pred, typename Proj>
+    static constexpr std::enable_if_t<RandomAccessIterator<I>, I>
+    impl_n(I first, iter_difference_t<I> n, Pred& pred, Proj& proj)
+    {
+        if (n == 0) {
+            return first;
+        }
+
+        while (n > 1) {
+            const auto half = n/2;
+
+            if (!detail::is_constant_evaluated() &&
+                static_cast<std::size_t>(n) * sizeof(iter_value_t<I>) >
+                    partition_point_prefetch_threshold) {
+                const auto h1 = (n - half)/2;
+                const auto h2 = (n - half - h1)/2;
+                partition_point_fn::prefetch(first + h2);
+                partition_point_fn::prefetch(first + (h1 + h2));
+                partition_point_fn::prefetch(first + (half + h2));
+                partition_point_fn::prefetch(first + (half + h1 + h2));
+            }
+
+            first += nano::invoke(pred, nano::invoke(proj, *(first + half)))
+                         ? half : 0;
+            n -= half;
+        }
+
+        return nano::invoke(pred, nano::invoke(proj, *first)) ? ++first
+                                                               : first;
+    }
+
+    // Performs count of the above searches over [first, first + n) at once,
+    // where the jth uses the predicate pred(j, x). The searches all run over
+    // ranges of the same length, so they proceed in lockstep, and the probes
+    // at each step are independent of each other: rather than waiting on
+    // memory for each search in turn, the CPU can overlap them. (This keeps
+    // it busier than prefetching would, so we don't.) The results are
+    // written to pos[0], ..., pos[count - 1].
+    template <typename I, typename Pred, typename Proj>
+    static constexpr void impl_n_batch(I first, iter_difference_t<I> n,
+                                       I* pos, int count, Pred& pred,
+                                       Proj& proj)
+    {
+        for (int j = 0; j < count; ++j) {
+            pos[j] = first;
+        }
+
+        if (n == 0) {
+            return;
+        }
+
+        while (n > 1) {
+            const auto half = n/2;
+
+            for (int j = 0; j < count; ++j) {
+                pos[j] += nano::invoke(pred, j,
+                                       nano::invoke(proj, *(pos[j] + half)))
+                              ? half : 0;
+            }
+            n -= half;
+        }
+
+        for (int j = 0; j < count; ++j) {
+            if (nano::invoke(pred, j, nano::invoke(proj, *pos[j]))) {
+                ++pos[j];
+            }
+        }
+    }
+
+    template <typename I>
+    static std::enable_if_t<std::is_lvalue_reference<iter_reference_t<I>>::value>
+    prefetch(const I& it)
+    {
+        NANO_PREFETCH(std::addressof(*it));
+    }
+
+    template <typename I>
+    static std::enable_if_t<!std::is_lvalue_reference<iter_reference_t<I>>::value>
+    prefetch(const I&)
+    {}
+
     template <typename I, typename S, typename Pred, typename Proj>
     static constexpr std::enable_if_t<SizedSentinel<S, I>, I>
     impl(I first, S last, Pred& pred, Proj& proj)
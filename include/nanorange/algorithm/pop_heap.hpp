@@ -22,11 +22,7 @@ private:
     static constexpr I impl(I first, iter_difference_t<I> n, Comp& comp,
                             Proj& proj)
     {
-        if (n > 1) {
-            nano::iter_swap(first, first + (n - 1));
-            detail::sift_down_n(first, n - 1, first, comp, proj);
-        }
-
+        detail::pop_heap_n(first, n, comp, proj);
         return first + n;
     }
 
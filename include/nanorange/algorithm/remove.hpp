@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -18,7 +19,8 @@ namespace detail {
 struct remove_fn {
 private:
     template <typename I, typename S, typename T, typename Proj>
-    static constexpr I impl(I first, S last, const T& value, Proj& proj)
+    static constexpr I impl(I first, S last, const T& value, Proj& proj,
+                            priority_tag<0>)
     {
         first = nano::find(std::move(first), last, value, proj);
 
@@ -36,6 +38,39 @@ private:
         return first;
     }
 
+    // Contiguous ranges of small trivially copyable types can be compacted
+    // without branching on the comparison
+    template <typename E, typename T, typename Proj>
+    static constexpr auto impl(E* first, E* last, const T& value, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<compactable<E>, E*>
+    {
+        auto pred = equal_to_pred<T>{value};
+        return detail::compact_remove_if(first, last, pred, proj);
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename T, typename Proj>
+    static constexpr auto range_impl(Rng& rng, const T& value, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos = remove_fn::impl(ptr, ptr + nano::size(rng), value,
+                                         proj, priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename T, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, const T& value,
+                                                Proj& proj, priority_tag<0>)
+    {
+        return remove_fn::impl(nano::begin(rng), nano::end(rng), value, proj,
+                               priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename T, typename Proj = identity>
     constexpr std::enable_if_t<
@@ -44,7 +79,8 @@ public:
         I>
     operator()(I first, S last, const T& value, Proj proj = Proj{}) const
     {
-        return remove_fn::impl(std::move(first), std::move(last), value, proj);
+        return remove_fn::impl(std::move(first), std::move(last), value, proj,
+                               priority_tag<1>{});
     }
 
     template <typename Rng, typename T, typename Proj = identity>
@@ -55,7 +91,7 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, const T& value, Proj proj = Proj{}) const
     {
-        return remove_fn::impl(nano::begin(rng), nano::end(rng), value, proj);
+        return remove_fn::range_impl(rng, value, proj, priority_tag<1>{});
     }
 };
 
@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_REMOVE_COPY_IF_HPP_INCLUDED
 
 #include <nanorange/algorithm/copy.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -20,7 +21,7 @@ struct remove_copy_if_fn {
 private:
     template <typename I, typename S, typename O, typename Pred, typename Proj>
     static constexpr remove_copy_if_result<I, O>
-    impl(I first, S last, O result, Pred& pred, Proj& proj)
+    impl(I first, S last, O result, Pred& pred, Proj& proj, priority_tag<0>)
     {
         while (first != last) {
             auto&& ref = *first;
@@ -33,6 +34,43 @@ private:
         return {std::move(first), std::move(result)};
     }
 
+    // Contiguous ranges of small trivially copyable types can be filtered
+    // without branching on the predicate
+    template <typename T, typename O, typename Pred, typename Proj>
+    static constexpr auto impl(T* first, T* last, O result, Pred& pred,
+                               Proj& proj, priority_tag<1>)
+        -> std::enable_if_t<compactable<std::remove_const_t<T>>,
+                            remove_copy_if_result<T*, O>>
+    {
+        return {last, detail::compact_copy_if<false>(first, last,
+                                                     std::move(result), pred,
+                                                     proj)};
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename O, typename Pred, typename Proj>
+    static constexpr auto range_impl(Rng& rng, O result, Pred& pred,
+                                     Proj& proj, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            remove_copy_if_result<iterator_t<Rng>, O>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        auto res = remove_copy_if_fn::impl(ptr, ptr + n, std::move(result),
+                                           pred, proj, priority_tag<1>{});
+        return {nano::begin(rng) + n, std::move(res.out)};
+    }
+
+    template <typename Rng, typename O, typename Pred, typename Proj>
+    static constexpr remove_copy_if_result<iterator_t<Rng>, O>
+    range_impl(Rng& rng, O result, Pred& pred, Proj& proj, priority_tag<0>)
+    {
+        return remove_copy_if_fn::impl(nano::begin(rng), nano::end(rng),
+                                       std::move(result), pred, proj,
+                                       priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename O, typename Pred,
               typename Proj = identity>
@@ -45,7 +83,8 @@ public:
                Proj proj = Proj{}) const
     {
         return remove_copy_if_fn::impl(std::move(first), std::move(last),
-                                    std::move(result), pred, proj);
+                                       std::move(result), pred, proj,
+                                       priority_tag<1>{});
     }
 
     template <typename Rng, typename O, typename Pred, typename Proj = identity>
@@ -56,8 +95,8 @@ public:
         remove_copy_if_result<safe_iterator_t<Rng>, O>>
     operator()(Rng&& rng, O result, Pred pred, Proj proj = Proj{}) const
     {
-        return remove_copy_if_fn::impl(nano::begin(rng), nano::end(rng),
-                                       std::move(result), pred, proj);
+        return remove_copy_if_fn::range_impl(rng, std::move(result), pred,
+                                             proj, priority_tag<1>{});
     }
 };
 
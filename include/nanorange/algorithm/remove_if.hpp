@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -18,7 +19,8 @@ namespace detail {
 struct remove_if_fn {
 private:
     template <typename I, typename S, typename Pred, typename Proj>
-    static constexpr I impl(I first, S last, Pred& pred, Proj& proj)
+    static constexpr I impl(I first, S last, Pred& pred, Proj& proj,
+                            priority_tag<0>)
     {
         first = nano::find_if(std::move(first), last, pred, proj);
 
@@ -36,6 +38,38 @@ private:
         return first;
     }
 
+    // Contiguous ranges of small trivially copyable types can be compacted
+    // without branching on the predicate
+    template <typename T, typename Pred, typename Proj>
+    static constexpr auto impl(T* first, T* last, Pred& pred, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<compactable<T>, T*>
+    {
+        return detail::compact_remove_if(first, last, pred, proj);
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename Pred, typename Proj>
+    static constexpr auto range_impl(Rng& rng, Pred& pred, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos = remove_if_fn::impl(ptr, ptr + nano::size(rng), pred,
+                                            proj, priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename Pred, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, Pred& pred,
+                                                Proj& proj, priority_tag<0>)
+    {
+        return remove_if_fn::impl(nano::begin(rng), nano::end(rng), pred, proj,
+                                  priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename Pred, typename Proj = identity>
     constexpr std::enable_if_t<
@@ -44,7 +78,8 @@ public:
         I>
     operator()(I first, S last, Pred pred, Proj proj = Proj{}) const
     {
-        return remove_if_fn::impl(std::move(first), std::move(last), pred, proj);
+        return remove_if_fn::impl(std::move(first), std::move(last), pred, proj,
+                                  priority_tag<1>{});
     }
 
     template <typename Rng, typename Pred, typename Proj = identity>
@@ -54,7 +89,7 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, Pred pred, Proj proj = Proj{}) const
     {
-        return remove_if_fn::impl(nano::begin(rng), nano::end(rng), pred, proj);
+        return remove_if_fn::range_impl(rng, pred, proj, priority_tag<1>{});
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_REVERSE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_REVERSE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_swap.hpp>
 #include <nanorange/ranges.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -16,7 +17,7 @@ namespace detail {
 struct reverse_fn {
 private:
     template <typename I>
-    static constexpr I impl(I first, I last)
+    static constexpr I impl(I first, I last, priority_tag<0>)
     {
         I ret = last;
         while (first != last && first !=  --last) {
@@ -30,10 +31,45 @@ private:
     template <typename I, typename S>
     static constexpr std::enable_if_t<
         !Same<I, S>, I>
-    impl(I first, S bound)
+    impl(I first, S bound, priority_tag<0>)
     {
         I last = next(first, bound);
-        return reverse_fn::impl(std::move(first), std::move(last));
+        return reverse_fn::impl(std::move(first), std::move(last),
+                                priority_tag<1>{});
+    }
+
+    // Contiguous ranges of trivially copyable types are reversed sixteen
+    // bytes at a time
+    template <typename T>
+    static constexpr auto impl(T* first, T* last, priority_tag<1>)
+        -> std::enable_if_t<simd_reversible<T>, T*>
+    {
+        if (!detail::is_constant_evaluated()) {
+            detail::simd_reverse(first, last);
+            return last;
+        }
+
+        return reverse_fn::impl(first, last, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng>
+    static constexpr auto range_impl(Rng& rng, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        reverse_fn::impl(ptr, ptr + n, priority_tag<1>{});
+        return nano::begin(rng) + n;
+    }
+
+    template <typename Rng>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, priority_tag<0>)
+    {
+        return reverse_fn::impl(nano::begin(rng), nano::end(rng),
+                                priority_tag<1>{});
     }
 
 public:
@@ -44,7 +80,8 @@ public:
         I>
     operator()(I first, S last) const
     {
-        return reverse_fn::impl(std::move(first), std::move(last));
+        return reverse_fn::impl(std::move(first), std::move(last),
+                                priority_tag<1>{});
     }
 
     template <typename Rng>
@@ -53,7 +90,7 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng) const
     {
-        return reverse_fn::impl(nano::begin(rng), nano::end(rng));
+        return reverse_fn::range_impl(rng, priority_tag<1>{});
     }
 };
 
@@ -7,6 +7,7 @@
 #ifndef NANORANGE_ALGORITHM_ROTATE_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_ROTATE_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/simd_swap.hpp>
 #include <nanorange/ranges.hpp>
 #include <nanorange/view/subrange.hpp>
 
@@ -17,7 +18,8 @@ namespace detail {
 struct rotate_fn {
 private:
     template <typename I, typename S>
-    static constexpr subrange<I> impl(I first, I middle, S last)
+    static constexpr subrange<I> impl(I first, I middle, S last,
+                                      priority_tag<0>)
     {
         if (first == middle) {
             auto ret = next(first, last);
@@ -51,6 +53,43 @@ private:
         return {std::move(ret), std::move(next)};
     }
 
+    // Contiguous ranges of trivially copyable types are rotated with memmove
+    // and block swaps
+    template <typename T>
+    static constexpr auto impl(T* first, T* middle, T* last, priority_tag<1>)
+        -> std::enable_if_t<bytewise_swappable<T>, subrange<T*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            return {detail::block_rotate(first, middle, last), last};
+        }
+
+        return rotate_fn::impl(first, middle, last, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng>
+    static constexpr auto range_impl(Rng& rng, iterator_t<Rng> middle,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            subrange<iterator_t<Rng>>>
+    {
+        const auto first = nano::begin(rng);
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        const auto res = rotate_fn::impl(ptr, ptr + (middle - first), ptr + n,
+                                         priority_tag<1>{});
+        return {first + (res.begin() - ptr), first + n};
+    }
+
+    template <typename Rng>
+    static constexpr subrange<iterator_t<Rng>>
+    range_impl(Rng& rng, iterator_t<Rng> middle, priority_tag<0>)
+    {
+        return rotate_fn::impl(nano::begin(rng), std::move(middle),
+                               nano::end(rng), priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S>
     constexpr std::enable_if_t<
@@ -60,7 +99,8 @@ public:
         subrange<I>>
     operator()(I first, I middle, S last) const
     {
-        return rotate_fn::impl(std::move(first), std::move(middle), std::move(last));
+        return rotate_fn::impl(std::move(first), std::move(middle),
+                               std::move(last), priority_tag<1>{});
     }
 
     template <typename Rng>
@@ -70,7 +110,7 @@ public:
         safe_subrange_t<Rng>>
     operator()(Rng&& rng, iterator_t<Rng> middle) const
     {
-        return rotate_fn::impl(nano::begin(rng), std::move(middle), nano::end(rng));
+        return rotate_fn::range_impl(rng, std::move(middle), priority_tag<1>{});
     }
 };
 
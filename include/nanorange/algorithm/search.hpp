@@ -7,6 +7,8 @@
 #ifndef NANORANGE_ALGORITHM_SEARCH_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SEARCH_HPP_INCLUDED
 
+#include <nanorange/algorithm/searchers.hpp>
+#include <nanorange/detail/algorithm/simd_search.hpp>
 #include <nanorange/ranges.hpp>
 #include <nanorange/view/subrange.hpp>
 
@@ -46,6 +48,65 @@ private:
         }
     }
 
+    // Contiguous ranges of characters can be searched sixteen positions at
+    // a time
+    template <typename T1, typename T2, typename Pred>
+    static constexpr auto dispatch(T1* first1, T1* last1, T2* first2,
+                                   T2* last2, Pred& pred, identity& proj1,
+                                   identity& proj2, priority_tag<1>)
+        -> std::enable_if_t<simd_searchable<T1, T2, Pred>, subrange<T1*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            T1* const pos = detail::simd_search(first1, last1, first2, last2);
+            return {pos, pos == last1 ? last1 : pos + (last2 - first2)};
+        }
+
+        return search_fn::impl(first1, last1, first2, last2, pred, proj1,
+                               proj2);
+    }
+
+    template <typename I1, typename S1, typename I2, typename S2,
+              typename Pred, typename Proj1, typename Proj2>
+    static constexpr subrange<I1>
+    dispatch(I1 first1, S1 last1, I2 first2, S2 last2, Pred& pred,
+             Proj1& proj1, Proj2& proj2, priority_tag<0>)
+    {
+        return search_fn::impl(std::move(first1), std::move(last1),
+                               std::move(first2), std::move(last2),
+                               pred, proj1, proj2);
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr auto range_impl(Rng1& rng1, Rng2& rng2, Pred& pred,
+                                     Proj1& proj1, Proj2& proj2,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && SizedRange<Rng1> &&
+                            ContiguousRange<Rng2> && SizedRange<Rng2>,
+                            subrange<iterator_t<Rng1>>>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto ptr2 = nano::data(rng2);
+        const auto res = search_fn::dispatch(
+            ptr1, ptr1 + nano::size(rng1), ptr2, ptr2 + nano::size(rng2), pred,
+            proj1, proj2, priority_tag<1>{});
+        const auto first = nano::begin(rng1);
+        return {first + (res.begin() - ptr1), first + (res.end() - ptr1)};
+    }
+
+    template <typename Rng1, typename Rng2, typename Pred, typename Proj1,
+              typename Proj2>
+    static constexpr subrange<iterator_t<Rng1>>
+    range_impl(Rng1& rng1, Rng2& rng2, Pred& pred, Proj1& proj1, Proj2& proj2,
+               priority_tag<0>)
+    {
+        return search_fn::dispatch(nano::begin(rng1), nano::end(rng1),
+                                   nano::begin(rng2), nano::end(rng2), pred,
+                                   proj1, proj2, priority_tag<1>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2,
               typename Pred = equal_to<>, typename Proj1 = identity,
@@ -60,9 +121,9 @@ public:
     operator()(I1 first1, S1 last1, I2 first2, S2 last2,
                Pred pred = Pred{}, Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return search_fn::impl(std::move(first1), std::move(last1),
-                               std::move(first2), std::move(last2),
-                               pred, proj1, proj2);
+        return search_fn::dispatch(std::move(first1), std::move(last1),
+                                   std::move(first2), std::move(last2),
+                                   pred, proj1, proj2, priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2,
@@ -76,9 +137,31 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, Pred pred = Pred{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return search_fn::impl(nano::begin(rng1), nano::end(rng1),
-                               nano::begin(rng2), nano::end(rng2),
-                               pred, proj1, proj2);
+        return search_fn::range_impl(rng1, rng2, pred, proj1, proj2,
+                                     priority_tag<1>{});
+    }
+
+    // Extension: looks for the pattern held by a searcher, such as
+    // boyer_moore_horspool_searcher or two_way_searcher
+    template <typename I, typename S, typename Searcher>
+    constexpr std::enable_if_t<
+        ForwardIterator<I> &&
+        Sentinel<S, I> &&
+        SearcherFor<Searcher, I, S>,
+        subrange<I>>
+    operator()(I first, S last, const Searcher& searcher) const
+    {
+        return searcher(std::move(first), std::move(last));
+    }
+
+    template <typename Rng, typename Searcher>
+    constexpr std::enable_if_t<
+        ForwardRange<Rng> &&
+        SearcherFor<Searcher, iterator_t<Rng>, sentinel_t<Rng>>,
+        safe_subrange_t<Rng>>
+    operator()(Rng&& rng, const Searcher& searcher) const
+    {
+        return searcher(nano::begin(rng), nano::end(rng));
     }
 };
 
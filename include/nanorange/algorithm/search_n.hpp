@@ -20,7 +20,7 @@ private:
     template <typename I, typename S, typename T, typename Pred, typename Proj>
     static constexpr subrange<I>
     impl(I first, S last, iter_difference_t<I> count, const T& value, Pred pred,
-         Proj& proj)
+         Proj& proj, priority_tag<0>)
     {
         if (count == iter_difference_t<I>{0}) {
             return {first, first};
@@ -54,6 +54,44 @@ private:
         return {first, first};
     }
 
+    // With random-access iterators, we can test the last element of each
+    // window of count elements first: if it does not match, then no run which
+    // includes it can, so we skip straight past it. On a mismatch we also
+    // remember how many elements after it are known to match, so that no
+    // element is looked at twice.
+    template <typename I, typename S, typename T, typename Pred, typename Proj>
+    static constexpr std::enable_if_t<RandomAccessIterator<I> &&
+                                      SizedSentinel<S, I>, subrange<I>>
+    impl(I first, S last, iter_difference_t<I> count, const T& value, Pred pred,
+         Proj& proj, priority_tag<1>)
+    {
+        if (count <= iter_difference_t<I>{0}) {
+            return {first, first};
+        }
+
+        auto n = last - first;
+        iter_difference_t<I> known = 0;
+
+        while (n >= count) {
+            auto i = count - 1;
+            while (i >= known &&
+                   nano::invoke(pred, nano::invoke(proj, first[i]), value)) {
+                --i;
+            }
+
+            if (i < known) {
+                return {first, first + count};
+            }
+
+            known = count - 1 - i;
+            first += i + 1;
+            n -= i + 1;
+        }
+
+        first += n;
+        return {first, first};
+    }
+
 public:
     template <typename I, typename S, typename T, typename Pred = equal_to<>,
         typename Proj = identity>
@@ -65,7 +103,7 @@ public:
         subrange<I>>
     {
         return search_n_fn::impl(std::move(first), std::move(last), count,
-                                 value, pred, proj);
+                                 value, pred, proj, priority_tag<1>{});
     }
 
     template <typename Rng, typename T, typename Pred = equal_to<>,
@@ -79,7 +117,7 @@ public:
         safe_subrange_t<Rng>>
     {
         return search_n_fn::impl(nano::begin(rng), nano::end(rng), count, value, pred,
-                                 proj);
+                                 proj, priority_tag<1>{});
     }
 };
 
@@ -0,0 +1,470 @@
+// nanorange/algorithm/searchers.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_SEARCHERS_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_SEARCHERS_HPP_INCLUDED
+
+#include <nanorange/view/subrange.hpp>
+
+#include <array>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////
+// nano::boyer_moore_horspool_searcher and nano::two_way_searcher
+// (extensions)
+//
+// Searchers hold a pattern, preprocessed once at construction, which can
+// then be looked for in any number of random-access haystacks by calling
+// searcher(first, last), or via nano::search(haystack, searcher). Like
+// std::search, they return the first occurrence, or an empty subrange at the
+// end of the haystack if there is none. As with the searchers in
+// <functional>, they keep an iterator to the pattern, which must outlive
+// them.
+//
+// boyer_moore_horspool_searcher compares the last element of the pattern
+// with the haystack first, and on a mismatch skips ahead by as much as the
+// length of the pattern (Horspool, "Practical fast searching in strings",
+// 1980). This is sublinear on typical inputs, but O(n * m) in the worst case.
+//
+// two_way_searcher uses the Two-Way algorithm of Crochemore and Perrin
+// ("Two-way string-matching", JACM 38(3), 1991), which needs an ordering on
+// the elements, but takes linear time in the worst case and allocates
+// nothing.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct SearcherFor_req {
+    template <typename Searcher, typename I, typename S>
+    auto requires_(const Searcher& searcher, I first, S last) -> decltype(
+        static_cast<subrange<I>>(searcher(std::move(first), std::move(last))));
+};
+
+// Whether Searcher can look for its pattern in [I, S)
+template <typename Searcher, typename I, typename S>
+NANO_CONCEPT SearcherFor = requires_<SearcherFor_req, Searcher, I, S>;
+
+// Whether the skip table for elements of type T compared with Pred can be
+// indexed directly by their value
+template <typename T, typename Pred>
+constexpr bool searcher_use_byte_table =
+    std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+    sizeof(T) == 1 && is_equal_to<Pred, T>::value;
+
+// The distance to skip ahead after each element in the Horspool algorithm
+template <typename T, typename D, typename Hash, typename Pred,
+          bool = searcher_use_byte_table<T, Pred>>
+class horspool_skip_table {
+public:
+    horspool_skip_table(D default_skip, Hash hash, Pred pred)
+        : default_skip_(default_skip),
+          map_(0, std::move(hash), key_equal{std::move(pred)})
+    {}
+
+    void set(const T& value, D skip) { map_[value] = skip; }
+
+    D get(const T& value) const
+    {
+        const auto it = map_.find(value);
+        return it == map_.end() ? default_skip_ : it->second;
+    }
+
+private:
+    struct key_equal {
+        Pred pred;
+
+        bool operator()(const T& a, const T& b) const
+        {
+            return nano::invoke(pred, a, b);
+        }
+    };
+
+    D default_skip_;
+    std::unordered_map<T, D, Hash, key_equal> map_;
+};
+
+template <typename T, typename D, typename Hash, typename Pred>
+class horspool_skip_table<T, D, Hash, Pred, true> {
+public:
+    horspool_skip_table(D default_skip, const Hash&, const Pred&)
+    {
+        table_.fill(default_skip);
+    }
+
+    void set(T value, D skip) { table_[static_cast<unsigned char>(value)] = skip; }
+
+    D get(T value) const { return table_[static_cast<unsigned char>(value)]; }
+
+private:
+    std::array<D, 256> table_;
+};
+
+// For byte-sized elements, the Two-Way algorithm can use the position of the
+// last occurrence of each value in the pattern to skip ahead as Horspool's
+// algorithm does, without giving up its linear bound. Otherwise this has no
+// information, and the search proceeds one comparison at a time.
+template <typename T, typename D, typename Comp,
+          bool = std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                 sizeof(T) == 1 && is_less<Comp, T>::value>
+class two_way_shift_table {
+public:
+    static constexpr bool enabled = false;
+
+    template <typename I>
+    void init(I, D) {}
+
+    D get(const T&) const { return 0; }
+};
+
+template <typename T, typename D, typename Comp>
+class two_way_shift_table<T, D, Comp, true> {
+public:
+    static constexpr bool enabled = true;
+
+    // Records one more than the last position of each value, or zero if it
+    // does not appear
+    template <typename I>
+    void init(I first, D size)
+    {
+        table_.fill(0);
+        for (D i = 0; i < size; ++i) {
+            table_[static_cast<unsigned char>(first[i])] = i + 1;
+        }
+    }
+
+    D get(T value) const { return table_[static_cast<unsigned char>(value)]; }
+
+private:
+    std::array<D, 256> table_;
+};
+
+} // namespace detail
+
+template <typename I, typename Hash = std::hash<iter_value_t<I>>,
+          typename Pred = equal_to<>>
+class boyer_moore_horspool_searcher {
+    static_assert(RandomAccessIterator<I>,
+                  "boyer_moore_horspool_searcher requires a random-access "
+                  "pattern");
+
+public:
+    using value_type = iter_value_t<I>;
+    using difference_type = iter_difference_t<I>;
+
+    template <typename S, std::enable_if_t<SizedSentinel<S, I>, int> = 0>
+    boyer_moore_horspool_searcher(I first, S last, Hash hash = Hash{},
+                                  Pred pred = Pred{})
+        : first_(first),
+          size_(last - first),
+          pred_(pred),
+          skip_(size_, std::move(hash), std::move(pred))
+    {
+        // Each element but the last lets us skip far enough ahead to line
+        // up its last occurrence in the pattern
+        for (difference_type i = 0; i < size_ - 1; ++i) {
+            skip_.set(first_[i], size_ - 1 - i);
+        }
+    }
+
+    template <typename R, std::enable_if_t<
+        detail::ForwardingRange<R> &&
+        Same<iterator_t<R>, I> &&
+        SizedSentinel<sentinel_t<R>, I>, int> = 0>
+    explicit boyer_moore_horspool_searcher(R&& r, Hash hash = Hash{},
+                                           Pred pred = Pred{})
+        : boyer_moore_horspool_searcher(nano::begin(r), nano::end(r),
+                                        std::move(hash), std::move(pred))
+    {}
+
+    template <typename I2, typename S2>
+    std::enable_if_t<
+        RandomAccessIterator<I2> &&
+        SizedSentinel<S2, I2> &&
+        Same<iter_value_t<I2>, value_type> &&
+        IndirectlyComparable<I2, I, Pred>,
+        subrange<I2>>
+    operator()(I2 first, S2 last) const
+    {
+        using D = iter_difference_t<I2>;
+        const D n = last - first;
+        const D m = static_cast<D>(size_);
+
+        if (m == 0) {
+            return {first, first};
+        }
+
+        for (D pos = 0; n - pos >= m;) {
+            iter_reference_t<I2>&& back = first[pos + m - 1];
+
+            if (nano::invoke(pred_, back, first_[m - 1])) {
+                D i = 0;
+                while (i < m - 1 &&
+                       nano::invoke(pred_, first[pos + i], first_[i])) {
+                    ++i;
+                }
+                if (i == m - 1) {
+                    return {first + pos, first + (pos + m)};
+                }
+            }
+
+            pos += static_cast<D>(skip_.get(back));
+        }
+
+        const I2 end = first + n;
+        return {end, end};
+    }
+
+private:
+    I first_;
+    difference_type size_;
+    Pred pred_;
+    detail::horspool_skip_table<value_type, difference_type, Hash, Pred> skip_;
+};
+
+template <typename I, typename Comp = less<>>
+class two_way_searcher {
+    static_assert(RandomAccessIterator<I>,
+                  "two_way_searcher requires a random-access pattern");
+
+public:
+    using value_type = iter_value_t<I>;
+    using difference_type = iter_difference_t<I>;
+
+    template <typename S, std::enable_if_t<SizedSentinel<S, I>, int> = 0>
+    two_way_searcher(I first, S last, Comp comp = Comp{})
+        : first_(first), size_(last - first), comp_(std::move(comp))
+    {
+        // Find a critical factorization pattern = u v, where |u| = split_ + 1,
+        // as the longer of the maximal suffixes under the ordering and its
+        // reverse, along with the period of v
+        difference_type period1 = 0;
+        difference_type period2 = 0;
+        const difference_type split1 = maximal_suffix(false, period1);
+        const difference_type split2 = maximal_suffix(true, period2);
+
+        split_ = split1 > split2 ? split1 : split2;
+        period_ = split1 > split2 ? period1 : period2;
+
+        // If u is a suffix of v's period, the whole pattern has that period,
+        // and after a full match we only need to check what lies beyond the
+        // part we have seen already. Otherwise, we can shift by more than
+        // either half of the pattern.
+        bool periodic = true;
+        for (difference_type i = 0; i <= split_; ++i) {
+            if (!equivalent(first_[i], first_[i + period_])) {
+                periodic = false;
+                break;
+            }
+        }
+
+        shift_.init(first_, size_);
+
+        if (periodic) {
+            memory_ = size_ - period_;
+        } else {
+            memory_ = 0;
+            period_ = (split_ > size_ - split_ - 1 ? split_
+                                                   : size_ - split_ - 1) + 1;
+        }
+    }
+
+    template <typename R, std::enable_if_t<
+        detail::ForwardingRange<R> &&
+        Same<iterator_t<R>, I> &&
+        SizedSentinel<sentinel_t<R>, I>, int> = 0>
+    explicit two_way_searcher(R&& r, Comp comp = Comp{})
+        : two_way_searcher(nano::begin(r), nano::end(r), std::move(comp))
+    {}
+
+    template <typename I2, typename S2>
+    std::enable_if_t<
+        RandomAccessIterator<I2> &&
+        SizedSentinel<S2, I2> &&
+        IndirectStrictWeakOrder<Comp, I2, I>,
+        subrange<I2>>
+    operator()(I2 first, S2 last) const
+    {
+        using D = iter_difference_t<I2>;
+        const D n = last - first;
+        const D m = static_cast<D>(size_);
+        const D split = static_cast<D>(split_);
+
+        if (m == 0) {
+            return {first, first};
+        }
+
+        // The number of elements at the start of the current window which we
+        // already know to match, after a shift by the period
+        D memory = 0;
+
+        for (D pos = 0; n - pos >= m;) {
+            // If the last element of the window does not line up with its
+            // last occurrence in the pattern, shift until it does
+            if (shift_.enabled) {
+                const D shift =
+                    m - static_cast<D>(shift_.get(first[pos + m - 1]));
+                if (shift != 0) {
+                    pos += shift > memory ? shift : memory;
+                    memory = 0;
+                    continue;
+                }
+            }
+
+            // Match v from left to right...
+            D i = split + 1 > memory ? split + 1 : memory;
+            while (i < m && equivalent(first[pos + i], first_[i])) {
+                ++i;
+            }
+            if (i < m) {
+                pos += i - split;
+                memory = 0;
+                continue;
+            }
+
+            // ...and then u from right to left
+            i = split + 1;
+            while (i > memory && equivalent(first[pos + i - 1], first_[i - 1])) {
+                --i;
+            }
+            if (i <= memory) {
+                return {first + pos, first + (pos + m)};
+            }
+
+            pos += static_cast<D>(period_);
+            memory = static_cast<D>(memory_);
+        }
+
+        const I2 end = first + n;
+        return {end, end};
+    }
+
+private:
+    template <typename T, typename U>
+    bool equivalent(T&& t, U&& u) const
+    {
+        return !nano::invoke(comp_, t, u) && !nano::invoke(comp_, u, t);
+    }
+
+    // Returns the position before the maximal suffix of the pattern (under
+    // the ordering, or its reverse), and sets period to the period of that
+    // suffix
+    difference_type maximal_suffix(bool reverse,
+                                   difference_type& period) const
+    {
+        difference_type before = -1;
+        difference_type candidate = 0;
+        difference_type k = 1;
+        period = 1;
+
+        while (candidate + k < size_) {
+            iter_reference_t<I>&& a = first_[before + k];
+            iter_reference_t<I>&& b = first_[candidate + k];
+
+            if (equivalent(a, b)) {
+                if (k == period) {
+                    candidate += period;
+                    k = 1;
+                } else {
+                    ++k;
+                }
+            } else if (reverse ? nano::invoke(comp_, a, b)
+                               : nano::invoke(comp_, b, a)) {
+                candidate += k;
+                k = 1;
+                period = candidate - before;
+            } else {
+                before = candidate;
+                ++candidate;
+                k = 1;
+                period = 1;
+            }
+        }
+
+        return before;
+    }
+
+    I first_;
+    difference_type size_;
+    Comp comp_;
+    difference_type split_ = -1;
+    difference_type period_ = 1;
+    difference_type memory_ = 0;
+    detail::two_way_shift_table<value_type, difference_type, Comp> shift_;
+};
+
+#ifdef NANO_HAVE_DEDUCTION_GUIDES
+
+template <typename I, typename S,
+          typename Hash = std::hash<iter_value_t<I>>,
+          typename Pred = equal_to<>>
+boyer_moore_horspool_searcher(I, S, Hash = Hash{}, Pred = Pred{})
+    -> boyer_moore_horspool_searcher<I, Hash, Pred>;
+
+template <typename R, typename Hash = std::hash<iter_value_t<iterator_t<R>>>,
+          typename Pred = equal_to<>,
+          std::enable_if_t<detail::ForwardingRange<R>, int> = 0>
+boyer_moore_horspool_searcher(R&&, Hash = Hash{}, Pred = Pred{})
+    -> boyer_moore_horspool_searcher<iterator_t<R>, Hash, Pred>;
+
+template <typename I, typename S, typename Comp = less<>>
+two_way_searcher(I, S, Comp = Comp{}) -> two_way_searcher<I, Comp>;
+
+template <typename R, typename Comp = less<>,
+          std::enable_if_t<detail::ForwardingRange<R>, int> = 0>
+two_way_searcher(R&&, Comp = Comp{}) -> two_way_searcher<iterator_t<R>, Comp>;
+
+#endif
+
+template <typename I, typename S, typename Hash = std::hash<iter_value_t<I>>,
+          typename Pred = equal_to<>>
+auto make_boyer_moore_horspool_searcher(I first, S last, Hash hash = Hash{},
+                                        Pred pred = Pred{})
+    -> std::enable_if_t<RandomAccessIterator<I> && SizedSentinel<S, I>,
+                        boyer_moore_horspool_searcher<I, Hash, Pred>>
+{
+    return boyer_moore_horspool_searcher<I, Hash, Pred>(
+        std::move(first), std::move(last), std::move(hash), std::move(pred));
+}
+
+template <typename R,
+          typename Hash = std::hash<iter_value_t<iterator_t<R>>>,
+          typename Pred = equal_to<>>
+auto make_boyer_moore_horspool_searcher(R&& r, Hash hash = Hash{},
+                                        Pred pred = Pred{})
+    -> std::enable_if_t<detail::ForwardingRange<R> && RandomAccessRange<R> &&
+                        SizedSentinel<sentinel_t<R>, iterator_t<R>>,
+                        boyer_moore_horspool_searcher<iterator_t<R>, Hash, Pred>>
+{
+    return boyer_moore_horspool_searcher<iterator_t<R>, Hash, Pred>(
+        std::forward<R>(r), std::move(hash), std::move(pred));
+}
+
+template <typename I, typename S, typename Comp = less<>>
+auto make_two_way_searcher(I first, S last, Comp comp = Comp{})
+    -> std::enable_if_t<RandomAccessIterator<I> && SizedSentinel<S, I>,
+                        two_way_searcher<I, Comp>>
+{
+    return two_way_searcher<I, Comp>(std::move(first), std::move(last),
+                                     std::move(comp));
+}
+
+template <typename R, typename Comp = less<>>
+auto make_two_way_searcher(R&& r, Comp comp = Comp{})
+    -> std::enable_if_t<detail::ForwardingRange<R> && RandomAccessRange<R> &&
+                        SizedSentinel<sentinel_t<R>, iterator_t<R>>,
+                        two_way_searcher<iterator_t<R>, Comp>>
+{
+    return two_way_searcher<iterator_t<R>, Comp>(std::forward<R>(r),
+                                                 std::move(comp));
+}
+
+NANO_END_NAMESPACE
+
+#endif
@@ -7,8 +7,12 @@
 #ifndef NANORANGE_ALGORITHM_SET_INTERSECTION_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SET_INTERSECTION_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/gallop.hpp>
+#include <nanorange/detail/algorithm/simd_set_intersection.hpp>
 #include <nanorange/ranges.hpp>
 
+#include <cstddef>
+
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
@@ -18,7 +22,8 @@ private:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp, typename Proj1, typename Proj2>
     static constexpr O impl(I1 first1, S1 last1, I2 first2, S2 last2,
-                            O result, Comp& comp, Proj1& proj1, Proj2& proj2)
+                            O result, Comp& comp, Proj1& proj1, Proj2& proj2,
+                            priority_tag<0>)
     {
         while (first1 != last1 && first2 != last2)
         {
@@ -39,6 +44,137 @@ private:
         return result;
     }
 
+    // With random-access inputs, we can gallop over long runs of unmatched
+    // elements in either range (see detail/algorithm/gallop.hpp). This makes
+    // intersecting a short range with a long one O(n1 log(n2 / n1)).
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr std::enable_if_t<gallopable<I1, S1, I2, S2>, O>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
+         Proj1& proj1, Proj2& proj2, priority_tag<1>)
+    {
+        int run1 = 0;
+        int run2 = 0;
+        // Whether the probe which ended a gallop has already shown that the
+        // current element of range1 (or range2) is not less than the other
+        bool not_less1 = false;
+        bool not_less2 = false;
+
+        while (first1 != last1 && first2 != last2) {
+            if (!not_less1 &&
+                nano::invoke(comp, nano::invoke(proj1, *first1),
+                             nano::invoke(proj2, *first2))) {
+                ++first1;
+                run2 = 0;
+                not_less2 = false;
+
+                if (++run1 >= min_gallop) {
+                    first1 += detail::gallop_lower_bound(
+                        first1, last1 - first1, nano::invoke(proj2, *first2),
+                        comp, proj1);
+                    run1 = 0;
+                    not_less1 = true;
+                }
+            } else if (!not_less2 &&
+                       nano::invoke(comp, nano::invoke(proj2, *first2),
+                                    nano::invoke(proj1, *first1))) {
+                ++first2;
+                run1 = 0;
+                not_less1 = false;
+
+                if (++run2 >= min_gallop) {
+                    first2 += detail::gallop_lower_bound(
+                        first2, last2 - first2, nano::invoke(proj1, *first1),
+                        comp, proj2);
+                    run2 = 0;
+                    not_less2 = true;
+                }
+            } else {
+                *result = *first1;
+                ++result;
+                ++first1;
+                ++first2;
+                run1 = 0;
+                run2 = 0;
+                not_less1 = false;
+                not_less2 = false;
+            }
+        }
+
+        return result;
+    }
+
+    // The vectorised kernel below looks at every element of both ranges, so
+    // it is not worth using if one is this many times longer than the other:
+    // galloping will skip most of the longer one instead
+    static constexpr std::ptrdiff_t simd_max_size_ratio = 32;
+
+    // Sorted ranges of 32-bit integers in contiguous storage can be
+    // intersected four elements at a time
+    template <typename T1, typename T2, typename O, typename Comp>
+    static constexpr auto dispatch(T1* first1, T1* last1, T2* first2,
+                                   T2* last2, O result, Comp& comp,
+                                   identity& proj1, identity& proj2,
+                                   priority_tag<1>)
+        -> std::enable_if_t<
+            Same<std::remove_const_t<T1>, std::remove_const_t<T2>> &&
+            simd_set_intersectable<std::remove_const_t<T1>, Comp>, O>
+    {
+        const auto n1 = last1 - first1;
+        const auto n2 = last2 - first2;
+
+        if (!detail::is_constant_evaluated() &&
+            n1 / simd_max_size_ratio <= n2 && n2 / simd_max_size_ratio <= n1) {
+            result = detail::simd_set_intersection(first1, last1, first2,
+                                                   last2, std::move(result));
+        }
+
+        return set_intersection_fn::impl(first1, last1, first2, last2,
+                                         std::move(result), comp, proj1,
+                                         proj2, priority_tag<1>{});
+    }
+
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr O dispatch(I1 first1, S1 last1, I2 first2, S2 last2,
+                                O result, Comp& comp, Proj1& proj1,
+                                Proj2& proj2, priority_tag<0>)
+    {
+        return set_intersection_fn::impl(std::move(first1), std::move(last1),
+                                         std::move(first2), std::move(last2),
+                                         std::move(result), comp, proj1, proj2,
+                                         priority_tag<1>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static constexpr auto range_impl(Rng1& rng1, Rng2& rng2, O result,
+                                     Comp& comp, Proj1& proj1, Proj2& proj2,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng1> && SizedRange<Rng1> &&
+                            ContiguousRange<Rng2> && SizedRange<Rng2>, O>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto ptr2 = nano::data(rng2);
+        return set_intersection_fn::dispatch(
+            ptr1, ptr1 + nano::size(rng1), ptr2, ptr2 + nano::size(rng2),
+            std::move(result), comp, proj1, proj2, priority_tag<1>{});
+    }
+
+    template <typename Rng1, typename Rng2, typename O, typename Comp,
+              typename Proj1, typename Proj2>
+    static constexpr O range_impl(Rng1& rng1, Rng2& rng2, O result,
+                                  Comp& comp, Proj1& proj1, Proj2& proj2,
+                                  priority_tag<0>)
+    {
+        return set_intersection_fn::dispatch(
+            nano::begin(rng1), nano::end(rng1), nano::begin(rng2),
+            nano::end(rng2), std::move(result), comp, proj1, proj2,
+            priority_tag<1>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp = less<>, typename Proj1 = identity,
@@ -53,9 +189,10 @@ public:
     operator()(I1 first1, S1 last1, I2 first2, S2 last2, O result,
                Comp comp = Comp{}, Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return set_intersection_fn::impl(std::move(first1), std::move(last1),
-                                         std::move(first2), std::move(last2),
-                                         std::move(result), comp, proj1, proj2);
+        return set_intersection_fn::dispatch(
+            std::move(first1), std::move(last1), std::move(first2),
+            std::move(last2), std::move(result), comp, proj1, proj2,
+            priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2, typename O, typename Comp = less<>,
@@ -69,9 +206,9 @@ public:
     operator()(Rng1&& rng1, Rng2&& rng2, O result, Comp comp = Comp{},
                Proj1 proj1 = Proj1{}, Proj2 proj2 = Proj2{}) const
     {
-        return set_intersection_fn::impl(nano::begin(rng1), nano::end(rng1),
-                                         nano::begin(rng2), nano::end(rng2),
-                                         std::move(result), comp, proj1, proj2);
+        return set_intersection_fn::range_impl(rng1, rng2, std::move(result),
+                                               comp, proj1, proj2,
+                                               priority_tag<1>{});
     }
 };
 
@@ -9,6 +9,7 @@
 
 #include <nanorange/algorithm/copy.hpp>
 #include <nanorange/algorithm/transform.hpp>
+#include <nanorange/detail/algorithm/gallop.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -24,7 +25,7 @@ private:
               typename Comp, typename Proj1, typename Proj2>
     static constexpr set_union_result<I1, I2, O>
     impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
-         Proj1& proj1, Proj2& proj2)
+         Proj1& proj1, Proj2& proj2, priority_tag<0>)
     {
         while (first1 != last1) {
             // If we've reached the end of the second range, copy any remaining
@@ -68,6 +69,87 @@ private:
                 std::move(copy_res.out)};
     }
 
+    // With random-access inputs, we can gallop over long runs from either
+    // range (see detail/algorithm/gallop.hpp)
+    template <typename I1, typename S1, typename I2, typename S2, typename O,
+              typename Comp, typename Proj1, typename Proj2>
+    static constexpr std::enable_if_t<gallopable<I1, S1, I2, S2>,
+                                      set_union_result<I1, I2, O>>
+    impl(I1 first1, S1 last1, I2 first2, S2 last2, O result, Comp& comp,
+         Proj1& proj1, Proj2& proj2, priority_tag<1>)
+    {
+        int run1 = 0;
+        int run2 = 0;
+        // Whether the probe which ended a gallop has already shown that the
+        // current element of range1 (or range2) is not less than the other
+        bool not_less1 = false;
+        bool not_less2 = false;
+
+        while (first1 != last1 && first2 != last2) {
+            if (!not_less1 &&
+                nano::invoke(comp, nano::invoke(proj1, *first1),
+                             nano::invoke(proj2, *first2))) {
+                *result = *first1;
+                ++first1;
+                ++result;
+                run2 = 0;
+                not_less2 = false;
+
+                // Copy the rest of the elements from range1 which are less
+                // than the current element from range2
+                if (++run1 >= min_gallop) {
+                    const auto n = detail::gallop_lower_bound(
+                        first1, last1 - first1, nano::invoke(proj2, *first2),
+                        comp, proj1);
+                    auto res = nano::copy(first1, first1 + n,
+                                          std::move(result));
+                    first1 = std::move(res.in);
+                    result = std::move(res.out);
+                    run1 = 0;
+                    not_less1 = true;
+                }
+            } else if (!not_less2 &&
+                       nano::invoke(comp, nano::invoke(proj2, *first2),
+                                    nano::invoke(proj1, *first1))) {
+                *result = *first2;
+                ++first2;
+                ++result;
+                run1 = 0;
+                not_less1 = false;
+
+                // Likewise for range2
+                if (++run2 >= min_gallop) {
+                    const auto n = detail::gallop_lower_bound(
+                        first2, last2 - first2, nano::invoke(proj1, *first1),
+                        comp, proj2);
+                    auto res = nano::copy(first2, first2 + n,
+                                          std::move(result));
+                    first2 = std::move(res.in);
+                    result = std::move(res.out);
+                    run2 = 0;
+                    not_less2 = true;
+                }
+            } else {
+                // The elements are equivalent, so we copy the one from range2
+                *result = *first2;
+                ++first1;
+                ++first2;
+                ++result;
+                run1 = 0;
+                run2 = 0;
+                not_less1 = false;
+                not_less2 = false;
+            }
+        }
+
+        auto res1 = nano::copy(std::move(first1), std::move(last1),
+                               std::move(result));
+        auto res2 = nano::copy(std::move(first2), std::move(last2),
+                               std::move(res1.out));
+
+        return {std::move(res1.in), std::move(res2.in), std::move(res2.out)};
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2, typename O,
               typename Comp = less<>, typename Proj1 = identity,
@@ -86,7 +168,7 @@ public:
         return set_union_fn::impl(std::move(first1), std::move(last1),
                                   std::move(first2), std::move(last2),
                                   std::move(result), comp,
-                                  proj1, proj2);
+                                  proj1, proj2, priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2, typename O, typename Comp = less<>,
@@ -103,7 +185,7 @@ public:
         return set_union_fn::impl(nano::begin(rng1), nano::end(rng1),
                                   nano::begin(rng2), nano::end(rng2),
                                   std::move(result), comp,
-                                  proj1, proj2);
+                                  proj1, proj2, priority_tag<1>{});
     }
 };
 
@@ -7,13 +7,55 @@
 #ifndef NANORANGE_ALGORITHM_SORT_HPP_INCLUDED
 #define NANORANGE_ALGORITHM_SORT_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/parallel_pdqsort.hpp>
 #include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/algorithm/radix_sort.hpp>
+#include <nanorange/execution.hpp>
 
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
 struct sort_fn {
+private:
+    // When sorting by integer or floating point keys using less or greater,
+    // a radix sort beats pdqsort on all but small inputs
+    template <typename I, typename Comp, typename Proj>
+    static constexpr std::enable_if_t<radix_sortable<I, Comp, Proj>>
+    impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        using K = radix_projected_t<I, Proj>;
+
+        if (!detail::is_constant_evaluated() &&
+            last - first >= radix_sort_threshold * int{sizeof(K)}) {
+            detail::radix_sort(std::move(first), std::move(last), comp, proj);
+        } else {
+            detail::pdqsort(std::move(first), std::move(last), comp, proj);
+        }
+    }
+
+    template <typename I, typename Comp, typename Proj>
+    static constexpr std::enable_if_t<!radix_sortable<I, Comp, Proj>>
+    impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        detail::pdqsort(std::move(first), std::move(last), comp, proj);
+    }
+
+    template <typename I, typename Comp, typename Proj>
+    static void impl(execution::sequenced_policy, I first, I last, Comp& comp,
+                     Proj& proj)
+    {
+        sort_fn::impl(std::move(first), std::move(last), comp, proj);
+    }
+
+    // Comp and Proj may be invoked concurrently from several threads
+    template <typename EP, typename I, typename Comp, typename Proj>
+    static void impl(EP, I first, I last, Comp& comp, Proj& proj)
+    {
+        detail::parallel_pdqsort(std::move(first), std::move(last), comp, proj);
+    }
+
+public:
     template <typename I, typename S, typename Comp = less<>, typename Proj = identity>
     constexpr std::enable_if_t<
         RandomAccessIterator<I> &&
@@ -22,7 +64,7 @@ struct sort_fn {
     operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         I last_it = nano::next(first, last);
-        detail::pdqsort(std::move(first), last_it, comp, proj);
+        sort_fn::impl(std::move(first), last_it, comp, proj);
         return last_it;
     }
 
@@ -34,7 +76,38 @@ struct sort_fn {
     operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
     {
         iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
-        detail::pdqsort(nano::begin(rng), last_it, comp, proj);
+        sort_fn::impl(nano::begin(rng), last_it, comp, proj);
+        return last_it;
+    }
+
+    // Extension: parallel sort
+    template <typename ExecutionPolicy, typename I, typename S,
+              typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        is_execution_policy_v<remove_cvref_t<ExecutionPolicy>> &&
+        RandomAccessIterator<I> &&
+        Sentinel<S, I> &&
+        Sortable<I, Comp, Proj>, I>
+    operator()(ExecutionPolicy&& policy, I first, S last, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, last);
+        sort_fn::impl(policy, std::move(first), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename ExecutionPolicy, typename Rng, typename Comp = less<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        is_execution_policy_v<remove_cvref_t<ExecutionPolicy>> &&
+        RandomAccessRange<Rng> &&
+        Sortable<iterator_t<Rng>, Comp, Proj>,
+    safe_iterator_t<Rng>>
+    operator()(ExecutionPolicy&& policy, Rng&& rng, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        sort_fn::impl(policy, nano::begin(rng), last_it, comp, proj);
         return last_it;
     }
 };
@@ -0,0 +1,320 @@
+// nanorange/algorithm/sorted_index.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_SORTED_INDEX_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_SORTED_INDEX_HPP_INCLUDED
+
+#include <nanorange/view/subrange.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+// nano::sorted_index
+// (an extension)
+//
+// A search index over a sorted random-access range which does not change.
+// The index holds a copy of the elements in Eytzinger (breadth-first) order,
+// as described by Khuong and Morin ("Array layouts for comparison-based
+// searching", ACM JEA 22, 2017): the children of the element at position k
+// are found at positions 2k and 2k + 1. The first few levels of the tree
+// stay in cache, and since the 16 great-great-grandchildren of each (small)
+// element share a cache line, we can prefetch four levels ahead.
+//
+// Queries take the same comparator and projection arguments as the
+// corresponding algorithms, and return iterators into the original range,
+// which must outlive the index.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Returns floor(log2(n)), for n > 0
+inline int sorted_index_log2(std::size_t n) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int>(8 * sizeof(unsigned long long) - 1) -
+           __builtin_clzll(n);
+#else
+    int log = 0;
+    while (n >>= 1) {
+        ++log;
+    }
+    return log;
+#endif
+}
+
+// Returns the number of trailing one bits in n
+inline int sorted_index_trailing_ones(std::size_t n) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return ~n == 0 ? int(8 * sizeof(std::size_t)) : __builtin_ctzll(~n);
+#else
+    int count = 0;
+    while (n & 1) {
+        n >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Allocates memory aligned to a cache line, so that each block of
+// descendants in a sorted_index lines up with one. We over-allocate, and
+// store the pointer we were given just before the block we return.
+template <typename T>
+struct sorted_index_allocator {
+    using value_type = T;
+
+    static constexpr std::size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+
+    sorted_index_allocator() = default;
+
+    template <typename U>
+    constexpr sorted_index_allocator(const sorted_index_allocator<U>&) noexcept
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        constexpr std::size_t overhead = alignment + sizeof(void*);
+        if (n > (SIZE_MAX - overhead) / sizeof(T)) {
+            throw std::bad_alloc{};
+        }
+
+        void* const raw = ::operator new(n * sizeof(T) + overhead);
+        std::uintptr_t addr =
+            reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+        addr = (addr + alignment - 1) & ~std::uintptr_t{alignment - 1};
+        reinterpret_cast<void**>(addr)[-1] = raw;
+        return reinterpret_cast<T*>(addr);
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+    }
+
+    template <typename U>
+    friend bool operator==(const sorted_index_allocator&,
+                           const sorted_index_allocator<U>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    friend bool operator!=(const sorted_index_allocator&,
+                           const sorted_index_allocator<U>&) noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace detail
+
+template <typename I>
+class sorted_index {
+    static_assert(RandomAccessIterator<I>,
+                  "sorted_index requires a random-access iterator");
+
+public:
+    using iterator = I;
+    using value_type = iter_value_t<I>;
+    using difference_type = iter_difference_t<I>;
+    using size_type = std::size_t;
+
+    sorted_index() = default;
+
+    template <typename S, std::enable_if_t<SizedSentinel<S, I>, int> = 0>
+    sorted_index(I first, S last)
+        : first_(std::move(first)),
+          size_(static_cast<size_type>(last - first_))
+    {
+        if (size_ == 0) {
+            return;
+        }
+
+        levels_ = detail::sorted_index_log2(size_) + 1;
+        last_level_size_ = size_ - ((size_type{1} << (levels_ - 1)) - 1);
+
+        // Position 0 is unused, but we fill it so that the tree is 1-based
+        tree_.reserve(size_ + 1);
+        tree_.emplace_back(*first_);
+        for (size_type k = 1; k <= size_; ++k) {
+            tree_.emplace_back(*(first_ + static_cast<difference_type>(rank(k))));
+        }
+    }
+
+    template <typename R, std::enable_if_t<
+        detail::ForwardingRange<R> &&
+        Same<iterator_t<R>, I> &&
+        SizedSentinel<sentinel_t<R>, I>, int> = 0>
+    explicit sorted_index(R&& r)
+        : sorted_index(nano::begin(r), nano::end(r))
+    {}
+
+    size_type size() const noexcept { return size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    I begin() const { return first_; }
+
+    I end() const { return first_ + static_cast<difference_type>(size_); }
+
+    template <typename T, typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        IndirectStrictWeakOrder<Comp, const T*, projected<const value_type*, Proj>>,
+        I>
+    lower_bound(const T& value, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto pred = [&](const value_type& elem) {
+            return nano::invoke(comp, nano::invoke(proj, elem), value);
+        };
+        return to_iterator(search(pred));
+    }
+
+    template <typename T, typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        IndirectStrictWeakOrder<Comp, const T*, projected<const value_type*, Proj>>,
+        I>
+    upper_bound(const T& value, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto pred = [&](const value_type& elem) {
+            return !nano::invoke(comp, value, nano::invoke(proj, elem));
+        };
+        return to_iterator(search(pred));
+    }
+
+    template <typename T, typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        IndirectStrictWeakOrder<Comp, const T*, projected<const value_type*, Proj>>,
+        subrange<I>>
+    equal_range(const T& value, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        return {this->lower_bound(value, comp, proj),
+                this->upper_bound(value, comp, proj)};
+    }
+
+    template <typename T, typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        IndirectStrictWeakOrder<Comp, const T*, projected<const value_type*, Proj>>,
+        bool>
+    binary_search(const T& value, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        const auto pred = [&](const value_type& elem) {
+            return nano::invoke(comp, nano::invoke(proj, elem), value);
+        };
+        const size_type k = search(pred);
+        return k != 0 && !nano::invoke(comp, value, nano::invoke(proj, tree_[k]));
+    }
+
+private:
+    // The descendants of position k which are log2(prefetch_stride) levels
+    // down start at position k * prefetch_stride, and fill a cache line
+    static constexpr size_type prefetch_stride =
+        sizeof(value_type) <= 4 ? 16 :
+        sizeof(value_type) <= 8 ? 8 :
+        sizeof(value_type) <= 16 ? 4 :
+        sizeof(value_type) <= 32 ? 2 : 1;
+
+    // Returns the position in the tree of the first element for which pred
+    // returns false, or 0 if there is no such element.
+    //
+    // We descend the tree going right whenever pred is true. The bits of the
+    // final position k (below the leading one) then record the path we took,
+    // with a 1 for each right turn. The element we want is the last one at
+    // which we turned left: we find it by dropping the trailing right turns,
+    // and then the left turn itself.
+    template <typename Pred>
+    size_type search(const Pred& pred) const
+    {
+        const value_type* const tree = tree_.data();
+        size_type k = 1;
+
+        while (k <= size_) {
+            // This address may be past the end of the tree, which is fine for
+            // a prefetch (but not for pointer arithmetic)
+            NANO_PREFETCH(reinterpret_cast<const void*>(
+                reinterpret_cast<std::uintptr_t>(tree) +
+                k * prefetch_stride * sizeof(value_type)));
+            k = 2 * k + static_cast<size_type>(pred(tree[k]));
+        }
+
+        return k >> (detail::sorted_index_trailing_ones(k) + 1);
+    }
+
+    // Returns the position in the sorted range of the element at position k
+    // of the tree (or the size of the range, for k = 0).
+    //
+    // In a perfect tree with the same number of levels, the in-order rank of
+    // k would follow directly from its level. Our tree differs from that one
+    // only in missing some leaves from the end of its last level, and leaves
+    // occupy every other position in the in-order sequence, so we need only
+    // subtract the number of missing leaves which would have come first.
+    size_type rank(size_type k) const noexcept
+    {
+        if (k == 0) {
+            return size_;
+        }
+
+        const int level = detail::sorted_index_log2(k);
+        size_type r = ((2 * k + 1) << (levels_ - 1 - level)) -
+                      (size_type{1} << levels_) - 1;
+
+        const size_type first_missing = 2 * last_level_size_;
+        if (r > first_missing) {
+            r -= (r - first_missing + 1) / 2;
+        }
+
+        return r;
+    }
+
+    I to_iterator(size_type k) const
+    {
+        return first_ + static_cast<difference_type>(rank(k));
+    }
+
+    I first_{};
+    size_type size_ = 0;
+    int levels_ = 0;
+    size_type last_level_size_ = 0;
+    std::vector<value_type, detail::sorted_index_allocator<value_type>> tree_;
+};
+
+#ifdef NANO_HAVE_DEDUCTION_GUIDES
+
+template <typename I, typename S>
+sorted_index(I, S) -> sorted_index<I>;
+
+template <typename R, std::enable_if_t<detail::ForwardingRange<R>, int> = 0>
+sorted_index(R&&) -> sorted_index<iterator_t<R>>;
+
+#endif
+
+// Extensions for C++14 compilers without CTAD
+
+template <typename I, typename S>
+auto make_sorted_index(I first, S last)
+    -> std::enable_if_t<RandomAccessIterator<I> && SizedSentinel<S, I>,
+                        sorted_index<I>>
+{
+    return sorted_index<I>(std::move(first), std::move(last));
+}
+
+template <typename R>
+auto make_sorted_index(R&& r)
+    -> std::enable_if_t<detail::ForwardingRange<R> && RandomAccessRange<R> &&
+                        SizedSentinel<sentinel_t<R>, iterator_t<R>>,
+                        sorted_index<iterator_t<R>>>
+{
+    return sorted_index<iterator_t<R>>(std::forward<R>(r));
+}
+
+NANO_END_NAMESPACE
+
+#endif
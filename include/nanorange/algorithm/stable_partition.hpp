@@ -0,0 +1,270 @@
+// nanorange/algorithm/stable_partition.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_STABLE_PARTITION_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_STABLE_PARTITION_HPP_INCLUDED
+
+#include <nanorange/algorithm/find.hpp>
+#include <nanorange/detail/algorithm/merge_adaptive.hpp>
+#include <nanorange/detail/memory/temporary_buffer.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+struct stable_partition_fn {
+private:
+    // Partitions [first, first + len) in a single pass, moving the elements
+    // which satisfy the predicate down towards first and the others into the
+    // buffer (which must have room for len elements), then moving the latter
+    // back into place. Returns the partition point. Requires that *first does
+    // not satisfy the predicate, so that no element is ever moved onto itself.
+    template <typename I, typename B, typename Pred, typename Proj>
+    static constexpr I partition_buffered(I first, iter_difference_t<I> len,
+                                          B buf, Pred& pred, Proj& proj)
+    {
+        I out = first;
+        B buf_last = buf;
+
+        *buf_last = nano::iter_move(first);
+        ++buf_last;
+        ++first;
+
+        for (--len; len > 0; --len, ++first) {
+            if (nano::invoke(pred, nano::invoke(proj, *first))) {
+                *out = nano::iter_move(first);
+                ++out;
+            } else {
+                *buf_last = nano::iter_move(first);
+                ++buf_last;
+            }
+        }
+
+        nano::move(buf, buf_last, out);
+        return out;
+    }
+
+    // As above, but for trivially copyable elements in contiguous storage.
+    // Each element is copied to both destinations, and the predicate only
+    // decides which of the two pointers moves on, so there is no branch for
+    // the CPU to mispredict.
+    template <typename T, typename Pred, typename Proj>
+    static constexpr std::enable_if_t<std::is_trivially_copyable<T>::value, T*>
+    partition_buffered(T* first, std::ptrdiff_t len, T* buf, Pred& pred,
+                       Proj& proj)
+    {
+        T* out = first;
+        T* buf_last = buf;
+
+        *buf_last = *first;
+        ++buf_last;
+        ++first;
+
+        for (--len; len > 0; --len, ++first) {
+            const T val = *first;
+            *out = val;
+            *buf_last = val;
+            const bool p = nano::invoke(pred, nano::invoke(proj, *first));
+            out += p;
+            buf_last += !p;
+        }
+
+        nano::move(buf, buf_last, out);
+        return out;
+    }
+
+    template <typename I, typename B>
+    static constexpr std::enable_if_t<BidirectionalIterator<I>, I>
+    rotate(I first, I middle, I last, B buf, iter_difference_t<B> buf_size)
+    {
+        return detail::rotate_adaptive(first, middle, last,
+                                       nano::distance(first, middle),
+                                       nano::distance(middle, last),
+                                       std::move(buf), buf_size);
+    }
+
+    template <typename I, typename B>
+    static constexpr std::enable_if_t<!BidirectionalIterator<I>, I>
+    rotate(I first, I middle, I last, B, iter_difference_t<B>)
+    {
+        return nano::rotate(std::move(first), std::move(middle),
+                            std::move(last)).begin();
+    }
+
+    // Stably partitions [first, first + len), where *first does not satisfy
+    // the predicate. If the range fits into the buffer we partition in a
+    // single pass through it. Otherwise we partition each half recursively,
+    // and rotate the false elements of the first half past the true elements
+    // of the second.
+    template <typename I, typename B, typename Pred, typename Proj>
+    static constexpr I impl_adaptive(I first, iter_difference_t<I> len, B buf,
+                                     iter_difference_t<B> buf_size,
+                                     Pred& pred, Proj& proj)
+    {
+        if (len == 1) {
+            return first;
+        }
+
+        if (len <= buf_size) {
+            return stable_partition_fn::partition_buffered(
+                std::move(first), len, std::move(buf), pred, proj);
+        }
+
+        const iter_difference_t<I> half = len / 2;
+        const I middle = nano::next(first, half);
+        const I left_split = stable_partition_fn::impl_adaptive(
+            first, half, buf, buf_size, pred, proj);
+
+        // Skip over the elements at the start of the second half which are
+        // already in the right place
+        iter_difference_t<I> right_len = len - half;
+        I right_split = middle;
+        while (right_len > 0 &&
+               nano::invoke(pred, nano::invoke(proj, *right_split))) {
+            ++right_split;
+            --right_len;
+        }
+
+        if (right_len > 0) {
+            right_split = stable_partition_fn::impl_adaptive(
+                right_split, right_len, buf, buf_size, pred, proj);
+        }
+
+        return stable_partition_fn::rotate(left_split, middle, right_split,
+                                           std::move(buf), buf_size);
+    }
+
+    template <typename I, typename S, typename Pred, typename Proj>
+    static I impl(I first, S last, Pred& pred, Proj& proj)
+    {
+        first = nano::find_if_not(std::move(first), last, pred, proj);
+
+        if (first == last) {
+            return first;
+        }
+
+        const iter_difference_t<I> len = nano::distance(first, last);
+        temporary_buffer<iter_value_t<I>> buf(static_cast<std::ptrdiff_t>(len),
+                                              first);
+        return stable_partition_fn::impl_adaptive(
+            std::move(first), len, buf.begin(), buf.size(), pred, proj);
+    }
+
+    template <typename I, typename S, typename Buf, typename Pred,
+              typename Proj>
+    static constexpr I impl(I first, S last, Buf& buf, Pred& pred, Proj& proj)
+    {
+        first = nano::find_if_not(std::move(first), last, pred, proj);
+
+        if (first == last) {
+            return first;
+        }
+
+        const iter_difference_t<I> len = nano::distance(first, last);
+        return stable_partition_fn::impl_adaptive(
+            std::move(first), len, scratch_begin(buf, priority_tag<1>{}),
+            nano::distance(buf), pred, proj);
+    }
+
+    // Contiguous buffers are accessed via pointers, which allows us to use the
+    // branchless version of partition_buffered()
+    template <typename Buf>
+    static constexpr auto scratch_begin(Buf& buf, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Buf>, decltype(nano::data(buf))>
+    {
+        return nano::data(buf);
+    }
+
+    template <typename Buf>
+    static constexpr iterator_t<Buf> scratch_begin(Buf& buf, priority_tag<0>)
+    {
+        return nano::begin(buf);
+    }
+
+    // Similarly, for contiguous ranges we do the work using pointers, and
+    // then translate the result back into an iterator
+    template <typename Rng, typename... Args>
+    static constexpr auto range_impl(Rng& rng, priority_tag<1>, Args&... args)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto res =
+            stable_partition_fn::impl(ptr, ptr + nano::size(rng), args...);
+        return nano::begin(rng) + (res - ptr);
+    }
+
+    template <typename Rng, typename... Args>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, priority_tag<0>,
+                                                Args&... args)
+    {
+        return stable_partition_fn::impl(nano::begin(rng), nano::end(rng),
+                                         args...);
+    }
+
+public:
+    template <typename I, typename S, typename Pred, typename Proj = identity>
+    std::enable_if_t<
+        ForwardIterator<I> &&
+        Sentinel<S, I> &&
+        IndirectUnaryPredicate<Pred, projected<I, Proj>> &&
+        Permutable<I>, I>
+    operator()(I first, S last, Pred pred, Proj proj = Proj{}) const
+    {
+        return stable_partition_fn::impl(std::move(first), std::move(last),
+                                         pred, proj);
+    }
+
+    template <typename Rng, typename Pred, typename Proj = identity>
+    std::enable_if_t<
+        ForwardRange<Rng> &&
+        IndirectUnaryPredicate<Pred, projected<iterator_t<Rng>, Proj>> &&
+        Permutable<iterator_t<Rng>>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Pred pred, Proj proj = Proj{}) const
+    {
+        return stable_partition_fn::range_impl(rng, priority_tag<1>{}, pred,
+                                               proj);
+    }
+
+    // Extension: use the RandomAccessRange buf as scratch space, rather than
+    // allocating a temporary buffer
+    template <typename I, typename S, typename Buf, typename Pred,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        ForwardIterator<I> &&
+        Sentinel<S, I> &&
+        ScratchBuffer<I, Buf> &&
+        IndirectUnaryPredicate<Pred, projected<I, Proj>> &&
+        Permutable<I>, I>
+    operator()(I first, S last, Buf&& buf, Pred pred, Proj proj = Proj{}) const
+    {
+        return stable_partition_fn::impl(std::move(first), std::move(last),
+                                         buf, pred, proj);
+    }
+
+    template <typename Rng, typename Buf, typename Pred,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        ForwardRange<Rng> &&
+        ScratchBuffer<iterator_t<Rng>, Buf> &&
+        IndirectUnaryPredicate<Pred, projected<iterator_t<Rng>, Proj>> &&
+        Permutable<iterator_t<Rng>>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Buf&& buf, Pred pred, Proj proj = Proj{}) const
+    {
+        return stable_partition_fn::range_impl(rng, priority_tag<1>{}, buf,
+                                               pred, proj);
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::stable_partition_fn, stable_partition)
+
+NANO_END_NAMESPACE
+
+#endif
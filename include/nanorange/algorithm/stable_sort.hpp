@@ -0,0 +1,147 @@
+// nanorange/algorithm/stable_sort.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_STABLE_SORT_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_STABLE_SORT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/merge_adaptive.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/memory/temporary_buffer.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Runs shorter than this are sorted using insertion sort
+constexpr int stable_sort_insertion_sort_threshold = 20;
+
+// A merge sort, using the buffer [buf, buf + buf_size) for the merges. If
+// the buffer can hold half of the input then every merge goes through it;
+// otherwise merge_adaptive falls back to rotations.
+template <typename I, typename B, typename Comp, typename Proj>
+constexpr void stable_sort_adaptive(I first, I last, iter_difference_t<I> len,
+                                    B buf, iter_difference_t<B> buf_size,
+                                    Comp& comp, Proj& proj)
+{
+    if (len <= stable_sort_insertion_sort_threshold) {
+        detail::insertion_sort(std::move(first), std::move(last), comp, proj);
+        return;
+    }
+
+    const iter_difference_t<I> half = len / 2;
+    const I middle = first + half;
+
+    detail::stable_sort_adaptive(first, middle, half, buf, buf_size, comp,
+                                 proj);
+    detail::stable_sort_adaptive(middle, last, len - half, buf, buf_size, comp,
+                                 proj);
+
+    // Nothing to do if the two halves are already in order
+    if (!nano::invoke(comp, nano::invoke(proj, *middle),
+                      nano::invoke(proj, *(middle - 1)))) {
+        return;
+    }
+
+    detail::merge_adaptive(std::move(first), std::move(middle),
+                           std::move(last), half, len - half, std::move(buf),
+                           buf_size, comp, proj);
+}
+
+struct stable_sort_fn {
+private:
+    template <typename I, typename Comp, typename Proj>
+    static void impl(I first, I last, Comp& comp, Proj& proj)
+    {
+        const iter_difference_t<I> len = last - first;
+
+        if (len <= stable_sort_insertion_sort_threshold) {
+            detail::insertion_sort(std::move(first), std::move(last), comp,
+                                   proj);
+            return;
+        }
+
+        temporary_buffer<iter_value_t<I>> buf(
+            static_cast<std::ptrdiff_t>((len + 1) / 2), first);
+        detail::stable_sort_adaptive(std::move(first), std::move(last), len,
+                                     buf.begin(), buf.size(), comp, proj);
+    }
+
+    template <typename I, typename Buf, typename Comp, typename Proj>
+    static constexpr void impl(I first, I last, Buf& buf, Comp& comp,
+                               Proj& proj)
+    {
+        const iter_difference_t<I> len = last - first;
+        detail::stable_sort_adaptive(std::move(first), std::move(last), len,
+                                     nano::begin(buf), nano::distance(buf),
+                                     comp, proj);
+    }
+
+public:
+    template <typename I, typename S, typename Comp = less<>,
+              typename Proj = identity>
+    std::enable_if_t<
+        RandomAccessIterator<I> &&
+        Sentinel<S, I> &&
+        Sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, std::move(last));
+        stable_sort_fn::impl(std::move(first), last_it, comp, proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Comp = less<>, typename Proj = identity>
+    std::enable_if_t<
+        RandomAccessRange<Rng> &&
+        Sortable<iterator_t<Rng>, Comp, Proj>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Comp comp = Comp{}, Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        stable_sort_fn::impl(nano::begin(rng), last_it, comp, proj);
+        return last_it;
+    }
+
+    // Extension: use the RandomAccessRange buf as scratch space, rather than
+    // allocating a temporary buffer
+    template <typename I, typename S, typename Buf, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessIterator<I> &&
+        Sentinel<S, I> &&
+        ScratchBuffer<I, Buf> &&
+        Sortable<I, Comp, Proj>, I>
+    operator()(I first, S last, Buf&& buf, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        I last_it = nano::next(first, std::move(last));
+        stable_sort_fn::impl(std::move(first), last_it, buf, comp, proj);
+        return last_it;
+    }
+
+    template <typename Rng, typename Buf, typename Comp = less<>,
+              typename Proj = identity>
+    constexpr std::enable_if_t<
+        RandomAccessRange<Rng> &&
+        ScratchBuffer<iterator_t<Rng>, Buf> &&
+        Sortable<iterator_t<Rng>, Comp, Proj>,
+        safe_iterator_t<Rng>>
+    operator()(Rng&& rng, Buf&& buf, Comp comp = Comp{},
+               Proj proj = Proj{}) const
+    {
+        iterator_t<Rng> last_it = nano::next(nano::begin(rng), nano::end(rng));
+        stable_sort_fn::impl(nano::begin(rng), last_it, buf, comp, proj);
+        return last_it;
+    }
+};
+
+} // namespace detail
+
+NANO_INLINE_VAR(detail::stable_sort_fn, stable_sort)
+
+NANO_END_NAMESPACE
+
+#endif
@@ -8,6 +8,7 @@
 #define NANORANGE_ALGORITHM_SWAP_RANGES_HPP_INCLUDED
 
 #include <nanorange/algorithm/mismatch.hpp>
+#include <nanorange/detail/algorithm/simd_swap.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -17,9 +18,10 @@ using swap_ranges_result = mismatch_result<I1, I2>;
 namespace detail {
 
 struct swap_ranges_fn {
+private:
     template <typename I1, typename S1, typename I2, typename S2>
     static constexpr swap_ranges_result<I1, I2>
-    impl4(I1 first1 ,S1 last1, I2 first2, S2 last2)
+    impl4(I1 first1 ,S1 last1, I2 first2, S2 last2, priority_tag<0>)
     {
         while (first1 != last1 && first2 != last2) {
             nano::iter_swap(first1, first2);
@@ -28,9 +30,29 @@ struct swap_ranges_fn {
         return {std::move(first1), std::move(first2)};
     }
 
+    // Contiguous ranges of trivially copyable types are swapped sixteen
+    // bytes at a time
+    template <typename T1, typename T2>
+    static constexpr auto impl4(T1* first1, T1* last1, T2* first2,
+                                T2* last2, priority_tag<1>)
+        -> std::enable_if_t<simd_swappable_ranges<T1, T2>,
+                            swap_ranges_result<T1*, T2*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            const auto n1 = last1 - first1;
+            const auto n2 = last2 - first2;
+            const auto n = n1 < n2 ? n1 : n2;
+            detail::simd_swap_ranges(first1, first2, n);
+            return {first1 + n, first2 + n};
+        }
+
+        return swap_ranges_fn::impl4(first1, last1, first2, last2,
+                                     priority_tag<0>{});
+    }
+
     template <typename I1, typename S1, typename I2>
     static constexpr swap_ranges_result<I1, I2>
-    impl3(I1 first1, S1 last1, I2 first2)
+    impl3(I1 first1, S1 last1, I2 first2, priority_tag<0>)
     {
         while (first1 != last1) {
             nano::iter_swap(first1, first2);
@@ -39,6 +61,48 @@ struct swap_ranges_fn {
         return {std::move(first1), std::move(first2)};
     }
 
+    template <typename T1, typename T2>
+    static constexpr auto impl3(T1* first1, T1* last1, T2* first2,
+                                priority_tag<1>)
+        -> std::enable_if_t<simd_swappable_ranges<T1, T2>,
+                            swap_ranges_result<T1*, T2*>>
+    {
+        if (!detail::is_constant_evaluated()) {
+            const auto n = last1 - first1;
+            detail::simd_swap_ranges(first1, first2, n);
+            return {last1, first2 + n};
+        }
+
+        return swap_ranges_fn::impl3(first1, last1, first2, priority_tag<0>{});
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng1, typename Rng2>
+    static constexpr auto range_impl(Rng1& rng1, Rng2& rng2, priority_tag<1>)
+        -> std::enable_if_t<
+            ContiguousRange<Rng1> && SizedRange<Rng1> &&
+            ContiguousRange<Rng2> && SizedRange<Rng2>,
+            swap_ranges_result<iterator_t<Rng1>, iterator_t<Rng2>>>
+    {
+        const auto ptr1 = nano::data(rng1);
+        const auto ptr2 = nano::data(rng2);
+        const auto res = swap_ranges_fn::impl4(
+            ptr1, ptr1 + nano::distance(rng1), ptr2,
+            ptr2 + nano::distance(rng2), priority_tag<1>{});
+        return {nano::begin(rng1) + (res.in1 - ptr1),
+                nano::begin(rng2) + (res.in2 - ptr2)};
+    }
+
+    template <typename Rng1, typename Rng2>
+    static constexpr swap_ranges_result<iterator_t<Rng1>, iterator_t<Rng2>>
+    range_impl(Rng1& rng1, Rng2& rng2, priority_tag<0>)
+    {
+        return swap_ranges_fn::impl4(nano::begin(rng1), nano::end(rng1),
+                                     nano::begin(rng2), nano::end(rng2),
+                                     priority_tag<1>{});
+    }
+
 public:
     template <typename I1, typename S1, typename I2, typename S2>
     constexpr std::enable_if_t<
@@ -51,7 +115,8 @@ public:
     operator()(I1 first1 ,S1 last1, I2 first2, S2 last2) const
     {
         return swap_ranges_fn::impl4(std::move(first1), std::move(last1),
-                                     std::move(first2), std::move(last2));
+                                     std::move(first2), std::move(last2),
+                                     priority_tag<1>{});
     }
 
     template <typename I1, typename S1, typename I2>
@@ -65,7 +130,7 @@ public:
     operator()(I1 first1 ,S1 last1, I2 first2) const
     {
         return swap_ranges_fn::impl3(std::move(first1), std::move(last1),
-                                     std::move(first2));
+                                     std::move(first2), priority_tag<1>{});
     }
 
     template <typename Rng1, typename Rng2>
@@ -76,8 +141,7 @@ public:
             swap_ranges_result<safe_iterator_t<Rng1>, safe_iterator_t<Rng2>>>
     operator()(Rng1&& rng1, Rng2&& rng2) const
     {
-        return swap_ranges_fn::impl4(nano::begin(rng1), nano::end(rng1),
-                                     nano::begin(rng2), nano::end(rng2));
+        return swap_ranges_fn::range_impl(rng1, rng2, priority_tag<1>{});
     }
 
     template <typename Rng1, typename I2>
@@ -90,7 +154,7 @@ public:
     operator()(Rng1&& rng1, I2 first2) const
     {
         return swap_ranges_fn::impl3(nano::begin(rng1), nano::end(rng1),
-                                     std::move(first2));
+                                     std::move(first2), priority_tag<1>{});
     }
 };
 
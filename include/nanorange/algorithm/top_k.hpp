@@ -0,0 +1,158 @@
+// nanorange/algorithm/top_k.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_ALGORITHM_TOP_K_HPP_INCLUDED
+#define NANORANGE_ALGORITHM_TOP_K_HPP_INCLUDED
+
+#include <nanorange/algorithm/sort_heap.hpp>
+#include <nanorange/detail/algorithm/heap_sift.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+// nano::top_k
+// (an extension)
+//
+// Accumulates the first k elements (according to Comp and Proj) of a
+// sequence which is fed to it a piece at a time, as partial_sort_copy would
+// choose them if it saw the whole sequence at once. For instance,
+// top_k<int, greater<>> keeps the k largest values.
+//
+// The elements are kept in a heap with the last of them at the root. Once
+// the heap is full, a single comparison against the root rejects each
+// element which cannot make the cut: an element equivalent to the root does
+// not displace it.
+//
+
+NANO_BEGIN_NAMESPACE
+
+template <typename T, typename Comp = less<>, typename Proj = identity>
+class top_k {
+    static_assert(Sortable<T*, Comp, Proj>,
+                  "top_k requires a type which is Sortable with Comp and Proj");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    explicit top_k(size_type k, Comp comp = Comp{}, Proj proj = Proj{})
+        : k_(k), comp_(std::move(comp)), proj_(std::move(proj))
+    {
+        heap_.reserve(k);
+    }
+
+    // The number of elements we are looking for
+    size_type k() const noexcept { return k_; }
+
+    // The number of elements we have so far, which is at most k
+    size_type size() const noexcept { return heap_.size(); }
+
+    bool empty() const noexcept { return heap_.empty(); }
+
+    void clear() noexcept { heap_.clear(); }
+
+    // Adds value to the accumulator, returning whether it (currently) makes
+    // the cut
+    bool push(const T& value) { return push_impl(value); }
+
+    bool push(T&& value) { return push_impl(std::move(value)); }
+
+    template <typename I, typename S>
+    std::enable_if_t<
+        InputIterator<I> &&
+        Sentinel<S, I> &&
+        Constructible<T, iter_reference_t<I>> &&
+        Assignable<T&, iter_reference_t<I>> &&
+        IndirectStrictWeakOrder<Comp, projected<I, Proj>,
+                                projected<const T*, Proj>>,
+        I>
+    insert(I first, S last)
+    {
+        for (; first != last && heap_.size() < k_; ++first) {
+            push_impl(*first);
+        }
+
+        if (first == last || k_ == 0) {
+            return nano::next(std::move(first), std::move(last));
+        }
+
+        // The heap is full, so its size no longer changes
+        T* const heap = heap_.data();
+        const auto n = static_cast<iter_difference_t<T*>>(k_);
+
+        for (; first != last; ++first) {
+            iter_reference_t<I>&& x = *first;
+            if (nano::invoke(comp_, nano::invoke(proj_, x),
+                             nano::invoke(proj_, *heap))) {
+                *heap = std::forward<iter_reference_t<I>>(x);
+                detail::sift_down_n(heap, n, heap, comp_, proj_);
+            }
+        }
+
+        return first;
+    }
+
+    template <typename Rng>
+    std::enable_if_t<
+        InputRange<Rng> &&
+        Constructible<T, iter_reference_t<iterator_t<Rng>>> &&
+        Assignable<T&, iter_reference_t<iterator_t<Rng>>> &&
+        IndirectStrictWeakOrder<Comp, projected<iterator_t<Rng>, Proj>,
+                                projected<const T*, Proj>>,
+        safe_iterator_t<Rng>>
+    insert(Rng&& rng)
+    {
+        return insert(nano::begin(rng), nano::end(rng));
+    }
+
+    // Returns the elements so far, in order
+    std::vector<T> sorted() const&
+    {
+        std::vector<T> vec = heap_;
+        nano::sort_heap(vec, comp_, proj_);
+        return vec;
+    }
+
+    std::vector<T> sorted() &&
+    {
+        nano::sort_heap(heap_, comp_, proj_);
+        return std::move(heap_);
+    }
+
+private:
+    template <typename U>
+    bool push_impl(U&& value)
+    {
+        const auto n = static_cast<iter_difference_t<T*>>(heap_.size());
+
+        if (heap_.size() < k_) {
+            heap_.emplace_back(std::forward<U>(value));
+            T* const first = heap_.data();
+            detail::sift_up_n(first, n + 1, comp_, proj_);
+            return true;
+        }
+
+        if (k_ == 0 || !nano::invoke(comp_, nano::invoke(proj_, value),
+                                     nano::invoke(proj_, heap_.front()))) {
+            return false;
+        }
+
+        T* const first = heap_.data();
+        *first = std::forward<U>(value);
+        detail::sift_down_n(first, n, first, comp_, proj_);
+        return true;
+    }
+
+    size_type k_;
+    std::vector<T> heap_;
+    Comp comp_;
+    Proj proj_;
+};
+
+NANO_END_NAMESPACE
+
+#endif
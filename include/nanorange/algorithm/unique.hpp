@@ -10,6 +10,7 @@
 #include <nanorange/ranges.hpp>
 
 #include <nanorange/algorithm/adjacent_find.hpp>
+#include <nanorange/detail/algorithm/compact.hpp>
 
 NANO_BEGIN_NAMESPACE
 
@@ -18,7 +19,8 @@ namespace detail {
 struct unique_fn {
 private:
     template <typename I, typename S, typename R, typename Proj>
-    static constexpr I impl(I first, S last, R& comp, Proj& proj)
+    static constexpr I impl(I first, S last, R& comp, Proj& proj,
+                            priority_tag<0>)
     {
         first = adjacent_find_fn::impl(std::move(first), last, comp, proj);
 
@@ -36,6 +38,39 @@ private:
         return ++first;
     }
 
+    // Contiguous ranges of small trivially copyable types can be compacted
+    // without branching on the comparison
+    template <typename T, typename R, typename Proj>
+    static constexpr auto impl(T* first, T* last, R& comp, Proj& proj,
+                               priority_tag<1>)
+        -> std::enable_if_t<compactable<T>, T*>
+    {
+        first = adjacent_find_fn::impl(first, last, comp, proj);
+        return detail::compact_unique(first, last, comp, proj);
+    }
+
+    // Contiguous ranges are accessed via pointers, so that they can use the
+    // above
+    template <typename Rng, typename R, typename Proj>
+    static constexpr auto range_impl(Rng& rng, R& comp, Proj& proj,
+                                     priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto pos = unique_fn::impl(ptr, ptr + nano::size(rng), comp,
+                                         proj, priority_tag<1>{});
+        return nano::begin(rng) + (pos - ptr);
+    }
+
+    template <typename Rng, typename R, typename Proj>
+    static constexpr iterator_t<Rng> range_impl(Rng& rng, R& comp, Proj& proj,
+                                                priority_tag<0>)
+    {
+        return unique_fn::impl(nano::begin(rng), nano::end(rng), comp, proj,
+                               priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename R = equal_to<>,
               typename Proj = identity>
@@ -47,7 +82,7 @@ public:
     operator()(I first, S last, R comp = {}, Proj proj = Proj{}) const
     {
         return unique_fn::impl(std::move(first), std::move(last),
-                               comp, proj);
+                               comp, proj, priority_tag<1>{});
     }
 
     template <typename Rng, typename R = equal_to<>, typename Proj = identity>
@@ -58,8 +93,7 @@ public:
             safe_iterator_t<Rng>>
     operator()(Rng&& rng, R comp = {}, Proj proj = Proj{}) const
     {
-        return unique_fn::impl(nano::begin(rng), nano::end(rng),
-                               comp, proj);
+        return unique_fn::range_impl(rng, comp, proj, priority_tag<1>{});
     }
 };
 
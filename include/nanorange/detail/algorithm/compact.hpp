@@ -0,0 +1,131 @@
+// nanorange/detail/algorithm/compact.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_COMPACT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_COMPACT_HPP_INCLUDED
+
+#include <nanorange/detail/functional/invoke.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::compact_remove_if, detail::compact_unique and
+// detail::compact_copy_if
+// (branch-free kernels for remove_if, remove, unique, copy_if and
+// remove_copy_if)
+//
+// The filtering algorithms branch on the predicate for every element, and on
+// data where it is unpredictable a mispredicted branch costs more than the
+// element itself. For contiguous ranges of small trivially copyable types we
+// instead turn the predicate into an integer which advances a write cursor:
+// the in-place algorithms copy every element to the cursor whether or not it
+// is kept, and the copying ones first record the positions of the elements
+// to keep from a block of the input, and then copy just those.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether contiguous ranges of T can be filtered without branching. Every
+// element is copied whether or not it is kept, which is only cheap for small
+// types, and only harmless for trivially copyable ones.
+template <typename T>
+constexpr bool compactable =
+    !std::is_volatile<T>::value && std::is_trivially_copyable<T>::value &&
+    std::is_trivially_copy_assignable<T>::value &&
+    std::is_trivially_move_assignable<T>::value && sizeof(T) <= 32;
+
+// Removes the elements of [first, last) for which pred holds of their
+// projections, and returns the end of those which remain
+template <typename T, typename Pred, typename Proj>
+constexpr T* compact_remove_if(T* first, T* last, Pred& pred, Proj& proj)
+{
+    // Elements before the first one removed stay where they are
+    while (first != last && !nano::invoke(pred, nano::invoke(proj, *first))) {
+        ++first;
+    }
+
+    if (first == last) {
+        return first;
+    }
+
+    T* out = first;
+    for (T* i = first + 1; i != last; ++i) {
+        const bool keep = !nano::invoke(pred, nano::invoke(proj, *i));
+        *out = std::move(*i);
+        out += keep;
+    }
+
+    return out;
+}
+
+// Removes all but the first of each run of equivalent elements of
+// [first, last), given that first is the first element of such a run (or
+// one of the last two positions, as returned by adjacent_find_fn::impl when
+// there is none), and returns the end of those which remain
+template <typename T, typename Comp, typename Proj>
+constexpr T* compact_unique(T* first, T* last, Comp& comp, Proj& proj)
+{
+    if (last - first < 2) {
+        return last;
+    }
+
+    // first is always the last element kept, and we write each candidate
+    // just after it. We compare against a copy of it, so that each comparison
+    // need not wait for the previous store.
+    T kept = *first;
+    for (T* n = first + 2; n != last; ++n) {
+        const T elem = *n;
+        const bool keep = !nano::invoke(comp, nano::invoke(proj, kept),
+                                        nano::invoke(proj, elem));
+        first[1] = elem;
+        first += keep;
+        kept = keep ? elem : kept;
+    }
+
+    return first + 1;
+}
+
+// Copies the elements of [first, last) for which pred holds of their
+// projections (or, if Keep is false, does not) to result, and returns the
+// end of the output
+template <bool Keep, typename T, typename O, typename Pred, typename Proj>
+constexpr O compact_copy_if(T* first, T* last, O result, Pred& pred,
+                            Proj& proj)
+{
+    constexpr std::ptrdiff_t block = 256;
+    unsigned char positions[block] = {};
+
+    while (first != last) {
+        const std::ptrdiff_t n = last - first < block ? last - first : block;
+
+        std::ptrdiff_t count = 0;
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            positions[count] = static_cast<unsigned char>(i);
+            count += static_cast<bool>(
+                         nano::invoke(pred, nano::invoke(proj, first[i]))) ==
+                     Keep;
+        }
+
+        for (std::ptrdiff_t i = 0; i < count; ++i) {
+            *result = first[positions[i]];
+            ++result;
+        }
+
+        first += n;
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
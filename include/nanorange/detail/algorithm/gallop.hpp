@@ -0,0 +1,129 @@
+// nanorange/detail/algorithm/gallop.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_GALLOP_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_GALLOP_HPP_INCLUDED
+
+#include <nanorange/detail/functional/invoke.hpp>
+#include <nanorange/detail/iterator/concepts.hpp>
+
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::gallop_lower_bound and detail::gallop_upper_bound
+// (exponential search, for the merge and set algorithms)
+//
+// The merge-like algorithms walk both of their inputs one element at a time,
+// which is O(n1 + n2) comparisons even when one input is much shorter than
+// the other. On random-access inputs they instead count how many times in a
+// row each input has advanced, and once that reaches min_gallop they search
+// ahead in it for the end of the run, as timsort does: probing 1, 2, 4, ...
+// elements ahead and then bisecting. A run of k elements costs about
+// 2 * log2(k) comparisons rather than k. The probe which ends the run has
+// already compared the next pair of elements, so the caller carries its
+// result over rather than comparing them again; a run which ends straight
+// away therefore costs nothing extra.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The number of times in a row that an input must advance before we start
+// searching ahead in it
+constexpr int min_gallop = 7;
+
+// Whether the merge-like algorithms can gallop over their inputs
+template <typename I1, typename S1, typename I2, typename S2>
+constexpr bool gallopable =
+    RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+    RandomAccessIterator<I2> && SizedSentinel<S2, I2>;
+
+// Returns the length of the leading run of [first, first + n) for which
+// pred(i) holds of the position i. Pred must be true for a prefix of the
+// range, and false for the rest. If the result is less than n, pred has been
+// found to fail at that position.
+template <typename I, typename D, typename Pred>
+constexpr D gallop_n(I first, D n, Pred pred)
+{
+    D lo = 0;
+    D hi = 0;
+
+    // Probe positions 0, 1, 3, 7, ..., until pred fails or we run off the end
+    while (hi < n && pred(first + hi)) {
+        lo = hi + 1;
+        hi = hi + lo;
+    }
+
+    if (hi > n) {
+        hi = n;
+    }
+
+    // Now pred holds at lo - 1 (if any), and fails at hi (if any)
+    while (lo < hi) {
+        const D mid = lo + (hi - lo) / 2;
+        if (pred(first + mid)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+template <typename V, typename Comp, typename Proj>
+struct gallop_less_pred {
+    V& value;
+    Comp& comp;
+    Proj& proj;
+
+    template <typename I>
+    constexpr bool operator()(const I& it) const
+    {
+        return nano::invoke(comp, nano::invoke(proj, *it), value);
+    }
+};
+
+template <typename V, typename Comp, typename Proj>
+struct gallop_not_greater_pred {
+    V& value;
+    Comp& comp;
+    Proj& proj;
+
+    template <typename I>
+    constexpr bool operator()(const I& it) const
+    {
+        return !nano::invoke(comp, value, nano::invoke(proj, *it));
+    }
+};
+
+// Returns the number of leading elements of [first, first + n) whose
+// projections are less than value
+template <typename I, typename D, typename V, typename Comp, typename Proj>
+constexpr D gallop_lower_bound(I first, D n, V&& value, Comp& comp,
+                               Proj& proj)
+{
+    return detail::gallop_n(std::move(first), n,
+                            gallop_less_pred<V, Comp, Proj>{value, comp, proj});
+}
+
+// Returns the number of leading elements of [first, first + n) whose
+// projections are not greater than value
+template <typename I, typename D, typename V, typename Comp, typename Proj>
+constexpr D gallop_upper_bound(I first, D n, V&& value, Comp& comp,
+                               Proj& proj)
+{
+    return detail::gallop_n(
+        std::move(first), n,
+        gallop_not_greater_pred<V, Comp, Proj>{value, comp, proj});
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -28,12 +28,17 @@
 #ifndef NANORANGE_DETAIL_ALGORITHM_HEAP_SIFT_HPP
 #define NANORANGE_DETAIL_ALGORITHM_HEAP_SIFT_HPP
 
+#include <nanorange/detail/concepts/core.hpp>
 #include <nanorange/detail/iterator/associated_types.hpp>
 #include <nanorange/detail/iterator/iter_move.hpp>
+#include <nanorange/detail/iterator/iter_swap.hpp>
 #include <nanorange/functional.hpp>
 
+#include <type_traits>
+
 ///////////////////////////////////////////////////////////////////////////
-// detail::sift_up_n and detail::sift_down_n
+// detail::sift_up_n, detail::sift_down_n and detail::pop_heap_n, and the
+// d-ary counterparts of the sifts
 // (heap implementation details)
 //
 
@@ -124,6 +129,171 @@ constexpr void sift_down_n(I first, iter_difference_t<I> n, I start, Comp& comp,
     *start = std::move(top);
 }
 
+// Moves the largest element in the heap [first, first + n) to its end, and
+// restores the heap property on the rest, with the rest of the heap unchanged.
+//
+// Rather than sifting the last element down from the root, comparing it with
+// the larger child at each level, we move the larger children up as far as a
+// leaf without looking at it, and then sift it up from there (Floyd's
+// "bottom-up" heapsort). As the last element of a heap usually belongs near
+// the bottom, this makes about half as many comparisons on large heaps, but
+// the extra moves only pay off when comparisons are relatively expensive.
+template <typename I, typename Comp, typename Proj>
+constexpr void pop_heap_bottom_up_n(I first, iter_difference_t<I> n,
+                                    Comp& comp, Proj& proj)
+{
+    if (n < 2) {
+        return;
+    }
+
+    iter_value_t<I> top = nano::iter_move(first);
+    const iter_difference_t<I> len = n - 1;
+    const I last = first + len;
+
+    // walk down to a leaf of the heap [first, last), moving the larger child
+    // into the hole at each level
+    I hole = first;
+    iter_difference_t<I> child = 0;
+    while (len >= 2 && child <= (len - 2) / 2) {
+        child = 2 * child + 1;
+        I child_i = first + child;
+
+        if ((child + 1) < len &&
+            nano::invoke(comp, nano::invoke(proj, *child_i),
+                         nano::invoke(proj, *(child_i + 1)))) {
+            // right-child exists and is greater than left-child
+            ++child_i;
+            ++child;
+        }
+
+        *hole = nano::iter_move(child_i);
+        hole = child_i;
+    }
+
+    // the hole is always within [first, last), never at last itself
+    *hole = nano::iter_move(last);
+    *last = std::move(top);
+    detail::sift_up_n(first, (hole - first) + 1, comp, proj);
+}
+
+// Whether pop_heap should use pop_heap_bottom_up_n() rather than
+// sift_down_n(). The former does fewer comparisons and more moves, so we
+// prefer the latter only when comparing is cheap: that is, for (unprojected)
+// scalar values.
+template <typename I, typename Proj>
+constexpr bool use_bottom_up_sift =
+    !(std::is_scalar<iter_value_t<I>>::value && Same<Proj, identity>);
+
+// Pops the heap [first, first + n) using whichever of the above is preferred
+template <typename I, typename Comp, typename Proj>
+constexpr void pop_heap_n(I first, iter_difference_t<I> n, Comp& comp,
+                          Proj& proj, std::true_type /* bottom-up */)
+{
+    detail::pop_heap_bottom_up_n(first, n, comp, proj);
+}
+
+template <typename I, typename Comp, typename Proj>
+constexpr void pop_heap_n(I first, iter_difference_t<I> n, Comp& comp,
+                          Proj& proj, std::false_type /* bottom-up */)
+{
+    if (n > 1) {
+        nano::iter_swap(first, first + (n - 1));
+        detail::sift_down_n(first, n - 1, first, comp, proj);
+    }
+}
+
+template <typename I, typename Comp, typename Proj>
+constexpr void pop_heap_n(I first, iter_difference_t<I> n, Comp& comp,
+                          Proj& proj)
+{
+    detail::pop_heap_n(std::move(first), n, comp, proj,
+                       std::integral_constant<bool,
+                           use_bottom_up_sift<I, Proj>>{});
+}
+
+// In a d-ary heap the children of position i are at D * i + 1, ..., D * i + D,
+// and its parent is at (i - 1) / D
+
+template <int D, typename I, typename Comp, typename Proj>
+constexpr void dary_sift_up_n(I first, iter_difference_t<I> n, Comp& comp,
+                              Proj& proj)
+{
+    if (n > 1) {
+        auto hole = n - 1;
+        auto parent = (hole - 1) / D;
+        if (nano::invoke(comp, nano::invoke(proj, *(first + parent)),
+                         nano::invoke(proj, *(first + hole)))) {
+            iter_value_t<I> v = nano::iter_move(first + hole);
+            do {
+                *(first + hole) = nano::iter_move(first + parent);
+                hole = parent;
+                if (hole == 0) {
+                    break;
+                }
+                parent = (hole - 1) / D;
+            } while (nano::invoke(comp, nano::invoke(proj, *(first + parent)),
+                                  nano::invoke(proj, v)));
+            *(first + hole) = std::move(v);
+        }
+    }
+}
+
+// Returns the position of the largest of the (at most D) children starting at
+// position child, where the heap has n elements
+template <int D, typename I, typename Comp, typename Proj>
+constexpr iter_difference_t<I>
+dary_largest_child(I first, iter_difference_t<I> n, iter_difference_t<I> child,
+                   Comp& comp, Proj& proj)
+{
+    I largest = first + child;
+    const I last = first + (n - child < D ? n : child + D);
+
+    for (I it = largest + 1; it != last; ++it) {
+        if (nano::invoke(comp, nano::invoke(proj, *largest),
+                         nano::invoke(proj, *it))) {
+            largest = it;
+        }
+    }
+
+    return largest - first;
+}
+
+template <int D, typename I, typename Comp, typename Proj>
+constexpr void dary_sift_down_n(I first, iter_difference_t<I> n,
+                                iter_difference_t<I> start, Comp& comp,
+                                Proj& proj)
+{
+    // (n - 2) / D is the last position with any children
+    if (n < 2 || (n - 2) / D < start) {
+        return;
+    }
+
+    auto child = detail::dary_largest_child<D>(first, n, D * start + 1, comp,
+                                               proj);
+
+    // check if we are in heap-order
+    if (nano::invoke(comp, nano::invoke(proj, *(first + child)),
+                     nano::invoke(proj, *(first + start)))) {
+        return;
+    }
+
+    iter_value_t<I> top = nano::iter_move(first + start);
+    do {
+        // we are not in heap-order, move the largest child up
+        *(first + start) = nano::iter_move(first + child);
+        start = child;
+
+        if ((n - 2) / D < start) {
+            break;
+        }
+
+        child = detail::dary_largest_child<D>(first, n, D * start + 1, comp,
+                                              proj);
+    } while (!nano::invoke(comp, nano::invoke(proj, *(first + child)),
+                           nano::invoke(proj, top)));
+    *(first + start) = std::move(top);
+}
+
 } // namespace detail
 
 NANO_END_NAMESPACE
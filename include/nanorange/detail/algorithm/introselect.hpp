@@ -0,0 +1,194 @@
+// nanorange/detail/algorithm/introselect.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_INTROSELECT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_INTROSELECT_HPP_INCLUDED
+
+#include <nanorange/algorithm/max_element.hpp>
+#include <nanorange/algorithm/min_element.hpp>
+#include <nanorange/algorithm/partial_sort.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::introselect
+// (used by nano::nth_element)
+//
+// This is pdqsort's partitioning loop, recursing only into the side
+// containing the nth element. On large inputs the pivot is chosen using the
+// sampling scheme of Floyd and Rivest ("Expected time bounds for selection",
+// CACM 18(3), 1975), which brings the expected number of comparisons down to
+// about N + min(k, N - k).
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Ranges longer than this choose their pivot by Floyd-Rivest sampling rather
+// than by a median-of-3 or ninther
+constexpr int introselect_floyd_rivest_threshold = 1500;
+
+template <typename T>
+constexpr T introselect_isqrt(T n)
+{
+    T x = n;
+    T y = (x + 1) / 2;
+    while (y < x) {
+        x = y;
+        y = (x + n / x) / 2;
+    }
+    return x;
+}
+
+// Finds a sample of [begin, end) surrounding nth which, once the nth element
+// has been selected within it, very probably leaves a good pivot at nth.
+// Floyd and Rivest take a sample of size s = n^(2/3) / 2 and widen it by
+// sd = sqrt(ln(n) * s * (n - s) / n) / 2 towards the middle of the range;
+// we approximate these using integer arithmetic (so that we can stay
+// constexpr).
+template <typename I>
+constexpr std::pair<I, I> introselect_sample(I begin, I nth, I end)
+{
+    using diff_t = iter_difference_t<I>;
+
+    const diff_t n = end - begin;
+    const diff_t k = nth - begin;
+    const int lg = detail::log2(n);
+
+    const diff_t s = (diff_t{1} << (2 * lg / 3)) / 2;
+    diff_t sd = detail::introselect_isqrt(diff_t{lg} * s * 7 / 10) / 2;
+    if (k < n / 2) {
+        sd = -sd;
+    }
+
+    const diff_t step = n / s;
+    diff_t lo = k - k / step + sd;
+    diff_t hi = k + (n - k) / step + sd;
+
+    // We need at least one element after nth in the sample, which guarantees
+    // that the partitioning scan will find an element which isn't less than
+    // the pivot
+    lo = lo < 0 ? 0 : (lo > k ? k : lo);
+    hi = hi >= n ? n - 1 : (hi <= k ? k + 1 : hi);
+
+    return {begin + lo, begin + (hi + 1)};
+}
+
+template <bool Branchless, typename I, typename Comp, typename Proj>
+constexpr void introselect_loop(I begin, I nth, I end, Comp& comp, Proj& proj,
+                                int bad_allowed, bool leftmost = true)
+{
+    using diff_t = iter_difference_t<I>;
+
+    while (true) {
+        const diff_t size = end - begin;
+
+        if (size < pdqsort_insertion_sort_threshold) {
+            detail::insertion_sort(begin, end, comp, proj);
+            return;
+        }
+
+        // Selecting the minimum or maximum is a simple linear scan
+        if (nth == begin) {
+            nano::iter_swap(begin, nano::min_element(begin, end, comp, proj));
+            return;
+        }
+        if (nth == end - 1) {
+            nano::iter_swap(nth, nano::max_element(begin, end, comp, proj));
+            return;
+        }
+
+        const bool sampled = size > introselect_floyd_rivest_threshold;
+
+        if (sampled) {
+            const std::pair<I, I> sample =
+                detail::introselect_sample(begin, nth, end);
+            detail::introselect_loop<Branchless>(sample.first, nth,
+                                                 sample.second, comp, proj,
+                                                 detail::log2(size));
+            nano::iter_swap(begin, nth);
+        } else {
+            detail::pdqsort_choose_pivot(begin, end, comp, proj);
+        }
+
+        // If the pivot is equal to the pivot of a previous partition step,
+        // which bounds this range from the left, then put all the elements
+        // equal to it on the left. There is no need to look at them again.
+        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
+                                       nano::invoke(proj, *begin))) {
+            I pivot_pos = detail::partition_left(begin, end, comp, proj);
+            if (nth <= pivot_pos) {
+                return;
+            }
+            begin = pivot_pos + 1;
+            continue;
+        }
+
+        const std::pair<I, bool> part_result =
+            Branchless ? detail::partition_right_branchless(begin, end, comp,
+                                                            proj)
+                       : detail::partition_right(begin, end, comp, proj);
+        const I pivot_pos = part_result.first;
+
+        const diff_t l_size = pivot_pos - begin;
+        const diff_t r_size = end - (pivot_pos + 1);
+
+        // A sampled pivot is deliberately placed just to one side of nth,
+        // so that nth is left in the smaller partition (unless it is near the
+        // middle, in which case both are about the same size). It has gone
+        // wrong only if nth ended up in a much larger one. Otherwise, we use
+        // pdqsort's test for a bad partition.
+        const bool bad = sampled
+            ? (nth < pivot_pos ? l_size : r_size) > size - size / 4
+            : l_size < size / 8 || r_size < size / 8;
+
+        if (bad) {
+            // Too many bad partitions: fall back to heap selection to
+            // guarantee O(N log N)
+            if (--bad_allowed == 0) {
+                nano::partial_sort(begin, nth + 1, end, comp, proj);
+                return;
+            }
+
+            if (!sampled) {
+                detail::pdqsort_break_patterns(begin, pivot_pos, end);
+            }
+        }
+
+        if (nth == pivot_pos) {
+            return;
+        }
+
+        if (nth < pivot_pos) {
+            end = pivot_pos;
+        } else {
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+}
+
+// Rearranges [begin, end) such that *nth is the element which would be there
+// if the range were sorted, with no element before it greater than it and no
+// element after it less than it
+template <typename I, typename Comp, typename Proj,
+          bool Branchless = pdqsort_use_branchless<I, Comp, Proj>>
+constexpr void introselect(I begin, I nth, I end, Comp& comp, Proj& proj)
+{
+    if (nth == end) {
+        return;
+    }
+
+    detail::introselect_loop<Branchless>(std::move(begin), std::move(nth),
+                                         std::move(end), comp, proj,
+                                         detail::log2(end - begin));
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,167 @@
+// nanorange/detail/algorithm/memmove.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_MEMMOVE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_MEMMOVE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/stream_store.hpp>
+#include <nanorange/iterator/move_iterator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::memmove_copy, detail::memmove_copy_backward and detail::bulk_fill
+// (memmove and memset kernels for copy, move and fill)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// The iterators which memmove_copy() can read from: pointers, and
+// move_iterators wrapping them (whose elements are moved rather than copied)
+template <typename I>
+struct memmove_source {
+    static constexpr bool enabled = false;
+    static constexpr bool moves = false;
+    using value_type = void;
+};
+
+template <typename T>
+struct memmove_source<T*> {
+    static constexpr bool enabled = true;
+    static constexpr bool moves = false;
+    using value_type = T;
+
+    static constexpr T* base(T* p) { return p; }
+};
+
+template <typename T>
+struct memmove_source<move_iterator<T*>> {
+    static constexpr bool enabled = true;
+    static constexpr bool moves = true;
+    using value_type = T;
+
+    static constexpr T* base(const move_iterator<T*>& i) { return i.base(); }
+};
+
+template <typename T>
+struct memmove_source<std::move_iterator<T*>> {
+    static constexpr bool enabled = true;
+    static constexpr bool moves = true;
+    using value_type = T;
+
+    static T* base(const std::move_iterator<T*>& i) { return i.base(); }
+};
+
+// Whether assigning the elements of a range [I, I) to a contiguous range of
+// U (by move if Move is true, otherwise by copy) can be done using memmove
+template <typename I, typename U, bool Move = memmove_source<I>::moves>
+constexpr bool memmove_assignable =
+    memmove_source<I>::enabled &&
+    std::is_same<std::remove_const_t<typename memmove_source<I>::value_type>,
+                 U>::value &&
+    !std::is_volatile<U>::value && std::is_trivially_copyable<U>::value &&
+    (Move ? std::is_trivially_move_assignable<U>::value
+          : std::is_trivially_copy_assignable<U>::value);
+
+// Whether filling a contiguous range of T with a value of type U can be done
+// by assigning value to a single element and copying its object
+// representation into the rest, using memset for bytes and non-temporal
+// stores for large ranges
+template <typename T, typename U>
+constexpr bool bulk_fillable =
+    stream_fillable<T> &&
+    ((std::is_scalar<T>::value && std::is_scalar<U>::value) ||
+     (std::is_same<T, U>::value && std::is_trivially_copy_assignable<T>::value));
+
+// Copies [first, last) to the range starting at result, which may overlap
+// it, and returns the end of the output. Large copies which do not overlap
+// are written with non-temporal stores.
+template <typename T, typename U>
+U* memmove_copy(T* first, T* last, U* result)
+{
+    const std::ptrdiff_t n = last - first;
+    if (n > 0) {
+        const std::size_t bytes = static_cast<std::size_t>(n) * sizeof(T);
+        const auto in = reinterpret_cast<std::uintptr_t>(first);
+        const auto out = reinterpret_cast<std::uintptr_t>(result);
+        if (detail::use_stream_copy(bytes) &&
+            (out + bytes <= in || in + bytes <= out)) {
+            detail::stream_copy(result, first, bytes);
+        } else {
+            std::memmove(result, first, bytes);
+        }
+    }
+    return result + n;
+}
+
+// Copies [first, last) to the range ending at result, which may overlap it,
+// and returns the start of the output
+template <typename T, typename U>
+U* memmove_copy_backward(T* first, T* last, U* result)
+{
+    const std::ptrdiff_t n = last - first;
+    if (n > 0) {
+        result -= n;
+        std::memmove(result, first, static_cast<std::size_t>(n) * sizeof(T));
+    }
+    return result;
+}
+
+// The value of an element of T after assigning value to it
+template <typename T>
+const T& assigned_element(const T& value, std::true_type)
+{
+    return value;
+}
+
+template <typename T, typename U>
+T assigned_element(const U& value, std::false_type)
+{
+    T elem{};
+    elem = value;
+    return elem;
+}
+
+// Assigns value to each of the n elements starting at first, and returns the
+// end of the range
+template <typename T, typename U>
+T* bulk_fill(T* first, std::ptrdiff_t n, const U& value)
+{
+    if (n <= 0) {
+        return first;
+    }
+
+    // Assign to a single element first, so that value is converted exactly
+    // as it would be by assigning it to each element
+    const T& elem =
+        detail::assigned_element<T>(value, std::is_same<T, U>{});
+
+    if (detail::use_stream_fill(static_cast<std::size_t>(n) * sizeof(T))) {
+        detail::stream_fill(first, n, elem);
+    } else if (sizeof(T) == 1) {
+        unsigned char byte;
+        std::memcpy(&byte, std::addressof(elem), 1);
+        std::memset(first, byte, static_cast<std::size_t>(n));
+    } else {
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            first[i] = elem;
+        }
+    }
+
+    return first + n;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
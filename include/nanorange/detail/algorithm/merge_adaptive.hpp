@@ -0,0 +1,217 @@
+// nanorange/detail/algorithm/merge_adaptive.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_MERGE_ADAPTIVE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_MERGE_ADAPTIVE_HPP_INCLUDED
+
+#include <nanorange/algorithm/lower_bound.hpp>
+#include <nanorange/algorithm/move.hpp>
+#include <nanorange/algorithm/rotate.hpp>
+#include <nanorange/algorithm/upper_bound.hpp>
+#include <nanorange/detail/memory/temporary_buffer.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::merge_adaptive
+// (the merge step of stable_sort and inplace_merge)
+//
+// These functions take a scratch buffer [buf, buf + buf_size) of objects of
+// the iterator's value type, which may be of any size (including zero).
+// The more of the input fits into the buffer, the less work they need to do.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Merges [first, middle) and [middle, last), where the first range fits into
+// the buffer. Equivalent elements are taken from the first range first.
+template <typename I, typename B, typename Comp, typename Proj>
+constexpr void merge_forward_buffered(I first, I middle, I last, B buf,
+                                      Comp& comp, Proj& proj)
+{
+    const B buf_end = nano::move(first, middle, buf).out;
+
+    while (buf != buf_end) {
+        if (middle == last) {
+            nano::move(buf, buf_end, first);
+            return;
+        }
+
+        if (nano::invoke(comp, nano::invoke(proj, *middle),
+                         nano::invoke(proj, *buf))) {
+            *first = nano::iter_move(middle);
+            ++middle;
+        } else {
+            *first = nano::iter_move(buf);
+            ++buf;
+        }
+        ++first;
+    }
+}
+
+// Merges [first, middle) and [middle, last) starting from the back, where the
+// second range fits into the buffer
+template <typename I, typename B, typename Comp, typename Proj>
+constexpr void merge_backward_buffered(I first, I middle, I last, B buf,
+                                       Comp& comp, Proj& proj)
+{
+    B buf_last = nano::move(middle, last, buf).out;
+
+    if (first == middle) {
+        nano::move_backward(buf, buf_last, last);
+        return;
+    }
+
+    --middle;
+    --buf_last;
+
+    while (true) {
+        if (nano::invoke(comp, nano::invoke(proj, *buf_last),
+                         nano::invoke(proj, *middle))) {
+            *--last = nano::iter_move(middle);
+            if (middle == first) {
+                nano::move_backward(buf, ++buf_last, last);
+                return;
+            }
+            --middle;
+        } else {
+            *--last = nano::iter_move(buf_last);
+            if (buf_last == buf) {
+                return;
+            }
+            --buf_last;
+        }
+    }
+}
+
+// Rotates [first, last) so that middle becomes the first element, using the
+// buffer to move the shorter side out of the way if it fits. Returns the new
+// position of first.
+template <typename I, typename B>
+constexpr I rotate_adaptive(I first, I middle, I last,
+                            iter_difference_t<I> len1,
+                            iter_difference_t<I> len2, B buf,
+                            iter_difference_t<B> buf_size)
+{
+    if (len2 <= len1 && len2 <= buf_size) {
+        if (len2 == 0) {
+            return first;
+        }
+        const B buf_end = nano::move(middle, last, buf).out;
+        nano::move_backward(first, middle, last);
+        return nano::move(buf, buf_end, first).out;
+    }
+
+    if (len1 <= buf_size) {
+        if (len1 == 0) {
+            return last;
+        }
+        const B buf_end = nano::move(first, middle, buf).out;
+        nano::move(middle, last, first);
+        return nano::move_backward(buf, buf_end, last).out;
+    }
+
+    return nano::rotate(first, middle, last).begin();
+}
+
+// Stably merges the sorted ranges [first, middle) and [middle, last), of
+// lengths len1 and len2. If the shorter of the two fits into the buffer we
+// merge through it directly; otherwise we split the longer range in half,
+// find the matching split point in the other one, rotate the middle section
+// into place and recurse. With no buffer at all, this is the classic
+// O(N log N) in-place merge.
+template <typename I, typename B, typename Comp, typename Proj>
+constexpr void merge_adaptive(I first, I middle, I last,
+                              iter_difference_t<I> len1,
+                              iter_difference_t<I> len2, B buf,
+                              iter_difference_t<B> buf_size, Comp& comp,
+                              Proj& proj)
+{
+    while (true) {
+        if (len1 == 0 || len2 == 0) {
+            return;
+        }
+
+        // Skip over the leading elements of the first range which are
+        // already in position
+        while (!nano::invoke(comp, nano::invoke(proj, *middle),
+                             nano::invoke(proj, *first))) {
+            ++first;
+            if (--len1 == 0) {
+                return;
+            }
+        }
+
+        if (len1 <= len2 && len1 <= buf_size) {
+            detail::merge_forward_buffered(std::move(first), std::move(middle),
+                                           std::move(last), std::move(buf),
+                                           comp, proj);
+            return;
+        }
+
+        if (len2 <= buf_size) {
+            detail::merge_backward_buffered(std::move(first),
+                                            std::move(middle), std::move(last),
+                                            std::move(buf), comp, proj);
+            return;
+        }
+
+        if (len1 == 1) {
+            // The lone element of the first range goes after every element
+            // of the second which is less than it
+            I pos = nano::lower_bound(middle, last, nano::invoke(proj, *first),
+                                      comp, proj);
+            nano::rotate(std::move(first), std::move(middle), std::move(pos));
+            return;
+        }
+
+        I cut1 = first;
+        I cut2 = middle;
+        iter_difference_t<I> len11 = 0;
+        iter_difference_t<I> len22 = 0;
+
+        if (len1 > len2) {
+            len11 = len1 / 2;
+            nano::advance(cut1, len11);
+            cut2 = nano::lower_bound(middle, last, nano::invoke(proj, *cut1),
+                                     comp, proj);
+            len22 = nano::distance(middle, cut2);
+        } else {
+            len22 = len2 / 2;
+            nano::advance(cut2, len22);
+            cut1 = nano::upper_bound(first, middle, nano::invoke(proj, *cut2),
+                                     comp, proj);
+            len11 = nano::distance(first, cut1);
+        }
+
+        I new_middle = detail::rotate_adaptive(cut1, middle, cut2,
+                                               len1 - len11, len22, buf,
+                                               buf_size);
+
+        // Recurse on the smaller half, and loop on the larger one
+        if (len11 + len22 < len1 + len2 - (len11 + len22)) {
+            detail::merge_adaptive(first, cut1, new_middle, len11, len22, buf,
+                                   buf_size, comp, proj);
+            first = std::move(new_middle);
+            middle = std::move(cut2);
+            len1 -= len11;
+            len2 -= len22;
+        } else {
+            detail::merge_adaptive(new_middle, cut2, last, len1 - len11,
+                                   len2 - len22, buf, buf_size, comp, proj);
+            middle = std::move(cut1);
+            last = std::move(new_middle);
+            len1 = len11;
+            len2 = len22;
+        }
+    }
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,77 @@
+// nanorange/detail/algorithm/parallel.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_HPP_INCLUDED
+
+#include <nanorange/execution.hpp>
+
+#include <future>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::parallel_invoke and friends
+// (fork-join helpers for the parallel algorithm overloads)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Returns the number of threads the parallel algorithms should aim to keep
+// busy. Never returns zero.
+inline unsigned parallel_concurrency()
+{
+    const unsigned n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+// Returns the depth to which a divide-and-conquer algorithm should keep
+// forking. We aim for a few more tasks than we have threads, so that
+// unevenly-sized pieces still keep every core busy.
+inline int parallel_fork_depth()
+{
+    int depth = 2;
+    for (unsigned n = parallel_concurrency(); n > 1; n >>= 1) {
+        ++depth;
+    }
+    return depth;
+}
+
+// Invokes f1 on the calling thread and f2 on a new thread, returning when
+// both have completed. If either throws, the exception is propagated to the
+// caller (after both have finished). If a new thread cannot be started, both
+// are invoked sequentially instead.
+template <typename F1, typename F2>
+void parallel_invoke(F1&& f1, F2&& f2)
+{
+    std::future<void> fut;
+
+    try {
+        fut = std::async(std::launch::async, std::ref(f2));
+    } catch (const std::system_error&) {
+        std::forward<F1>(f1)();
+        std::forward<F2>(f2)();
+        return;
+    }
+
+    try {
+        std::forward<F1>(f1)();
+    } catch (...) {
+        fut.wait();
+        throw;
+    }
+
+    fut.get();
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,97 @@
+// nanorange/detail/algorithm/parallel_merge.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_MERGE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_MERGE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/parallel.hpp>
+#include <nanorange/detail/functional/invoke.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::merge_path_split and detail::parallel_merge
+// (implementation of the parallel merge)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Merges with fewer output elements than this are not worth handing to
+// another thread, and are done by the sequential merge instead.
+constexpr int merge_parallel_threshold = 1 << 15;
+
+// Returns the number of elements of [first1, first1 + n1) among the first
+// diag elements of the (stable) merge of that range with [first2, first2 + n2).
+// The rest of them come from the start of the second range.
+//
+// This is the point at which the "merge path" crosses the diagonal diag of
+// the n1 * n2 grid, which we find by binary search along it (Odeh, Green,
+// Mwassi, Shmueli and Birk, "Merge Path - Parallel Merging Made Simple",
+// IPDPS 2012). Taking i elements from the first range is too many if its
+// i-th element must follow the (diag - i)-th element of the second range:
+// that is, if the latter is strictly less than the former, as elements of
+// the first range precede equivalent elements of the second.
+template <typename I1, typename I2, typename D, typename Comp,
+          typename Proj1, typename Proj2>
+D merge_path_split(I1 first1, D n1, I2 first2, D n2, D diag, Comp& comp,
+                   Proj1& proj1, Proj2& proj2)
+{
+    D lo = diag > n2 ? diag - n2 : 0;
+    D hi = diag < n1 ? diag : n1;
+
+    while (lo < hi) {
+        const D mid = lo + (hi - lo) / 2;
+        if (nano::invoke(comp, nano::invoke(proj2, *(first2 + (diag - mid - 1))),
+                         nano::invoke(proj1, *(first1 + mid)))) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    return lo;
+}
+
+// Merges [first1, first1 + n1) and [first2, first2 + n2) into
+// [out, out + n1 + n2). We split the output in half along the merge path,
+// and merge the two halves concurrently, until we have forked enough tasks
+// to keep every thread busy (or the pieces become small). Each piece is then
+// handed to seq_merge, which is invoked as
+// seq_merge(first1, last1, first2, last2, out).
+template <typename I1, typename I2, typename O, typename D, typename Comp,
+          typename Proj1, typename Proj2, typename SeqMerge>
+void parallel_merge(I1 first1, D n1, I2 first2, D n2, O out, Comp& comp,
+                    Proj1& proj1, Proj2& proj2, SeqMerge& seq_merge,
+                    int depth)
+{
+    if (depth <= 0 || n1 + n2 < merge_parallel_threshold) {
+        seq_merge(first1, first1 + n1, first2, first2 + n2, std::move(out));
+        return;
+    }
+
+    const D diag = (n1 + n2) / 2;
+    const D i = detail::merge_path_split(first1, n1, first2, n2, diag, comp,
+                                         proj1, proj2);
+    const D j = diag - i;
+
+    --depth;
+    detail::parallel_invoke(
+        [&] {
+            detail::parallel_merge(first1, i, first2, j, out, comp, proj1,
+                                   proj2, seq_merge, depth);
+        },
+        [&] {
+            detail::parallel_merge(first1 + i, n1 - i, first2 + j, n2 - j,
+                                   out + diag, comp, proj1, proj2, seq_merge,
+                                   depth);
+        });
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,108 @@
+// nanorange/detail/algorithm/parallel_pdqsort.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_PARALLEL_PDQSORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_PARALLEL_PDQSORT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/parallel.hpp>
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Partitions smaller than this are not worth handing to another thread, and
+// are sorted with the sequential pdqsort instead.
+constexpr int pdqsort_parallel_threshold = 1 << 15;
+
+// The top levels of pdqsort_loop, with the two partitions produced by each
+// step sorted concurrently. Once we have forked enough tasks to keep every
+// thread busy (or the partitions become small) each piece is handed to the
+// sequential pdqsort_loop.
+template <bool Branchless, typename I, typename Comp, typename Proj>
+void parallel_pdqsort_loop(I begin, I end, Comp& comp, Proj& proj,
+                           int bad_allowed, int depth, bool leftmost)
+{
+    using diff_t = iter_difference_t<I>;
+
+    while (true) {
+        const diff_t size = end - begin;
+
+        if (depth <= 0 || size < pdqsort_parallel_threshold) {
+            detail::pdqsort_loop<Branchless>(std::move(begin), std::move(end),
+                                             comp, proj, bad_allowed,
+                                             leftmost);
+            return;
+        }
+
+        detail::pdqsort_choose_pivot(begin, end, comp, proj);
+
+        // See pdqsort_loop(). Note that *(begin - 1) is the pivot of a
+        // previous partition step, which no other task will touch.
+        if (!leftmost && !nano::invoke(comp, nano::invoke(proj, *(begin - 1)),
+                                       nano::invoke(proj, *begin))) {
+            begin = partition_left(begin, end, comp, proj) + 1;
+            continue;
+        }
+
+        std::pair<I, bool> part_result =
+            Branchless ? partition_right_branchless(begin, end, comp, proj)
+                       : partition_right(begin, end, comp, proj);
+        I pivot_pos = part_result.first;
+        const bool already_partitioned = part_result.second;
+
+        const diff_t l_size = pivot_pos - begin;
+        const diff_t r_size = end - (pivot_pos + 1);
+
+        if (l_size < size / 8 || r_size < size / 8) {
+            if (--bad_allowed == 0) {
+                nano::make_heap(begin, end, comp, proj);
+                nano::sort_heap(begin, end, comp, proj);
+                return;
+            }
+
+            detail::pdqsort_break_patterns(begin, pivot_pos, end);
+        } else if (already_partitioned &&
+                   partial_insertion_sort(begin, pivot_pos, comp, proj) &&
+                   partial_insertion_sort(pivot_pos + 1, end, comp, proj)) {
+            return;
+        }
+
+        --depth;
+        detail::parallel_invoke(
+            [&] {
+                detail::parallel_pdqsort_loop<Branchless>(
+                    begin, pivot_pos, comp, proj, bad_allowed, depth,
+                    leftmost);
+            },
+            [&] {
+                detail::parallel_pdqsort_loop<Branchless>(
+                    pivot_pos + 1, end, comp, proj, bad_allowed, depth,
+                    false);
+            });
+        return;
+    }
+}
+
+template <typename I, typename Comp, typename Proj,
+          bool Branchless = pdqsort_use_branchless<I, Comp, Proj>>
+void parallel_pdqsort(I begin, I end, Comp& comp, Proj& proj)
+{
+    if (begin == end) {
+        return;
+    }
+
+    const int bad_allowed = detail::log2(nano::distance(begin, end));
+    detail::parallel_pdqsort_loop<Branchless>(
+        std::move(begin), std::move(end), comp, proj, bad_allowed,
+        detail::parallel_fork_depth(), true);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,309 @@
+// nanorange/detail/algorithm/radix_sort.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_RADIX_SORT_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/pdqsort.hpp>
+#include <nanorange/detail/memory/temporary_buffer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+///////////////////////////////////////////////////////////////////////////
+// detail::radix_sort
+// (used by nano::sort when sorting by arithmetic keys with less/greater)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Ranges shorter than this (per byte of key) are sorted using pdqsort instead
+constexpr std::ptrdiff_t radix_sort_threshold = 512;
+
+// Buckets smaller than this are finished off by pdqsort during an in-place
+// (American flag) radix sort
+constexpr std::ptrdiff_t american_flag_sort_threshold = 128;
+
+template <std::size_t Size>
+struct radix_uint {};
+
+template <>
+struct radix_uint<1> { using type = std::uint8_t; };
+template <>
+struct radix_uint<2> { using type = std::uint16_t; };
+template <>
+struct radix_uint<4> { using type = std::uint32_t; };
+template <>
+struct radix_uint<8> { using type = std::uint64_t; };
+
+// Maps a key of type K to an unsigned integer with the same ordering.
+// Signed integers have their sign bit flipped. IEEE floats have their sign bit
+// flipped if positive and all their bits flipped if negative, which places
+// (negatively-signed) NaNs first and (positively-signed) NaNs last.
+template <typename K, typename = void>
+struct radix_key {};
+
+template <typename K>
+struct radix_key<K, std::enable_if_t<std::is_integral<K>::value &&
+                                     !std::is_same<K, bool>::value &&
+                                     sizeof(K) <= 8>> {
+    using type = typename radix_uint<sizeof(K)>::type;
+
+    static type get(K k) noexcept
+    {
+        constexpr type sign_bit = std::is_signed<K>::value
+            ? type(type{1} << (8 * sizeof(K) - 1)) : type{0};
+        return type(type(k) ^ sign_bit);
+    }
+};
+
+template <typename K>
+struct radix_key<K, std::enable_if_t<std::is_floating_point<K>::value &&
+                                     std::numeric_limits<K>::is_iec559 &&
+                                     (sizeof(K) == 4 || sizeof(K) == 8)>> {
+    using type = typename radix_uint<sizeof(K)>::type;
+
+    static type get(K k) noexcept
+    {
+        constexpr type sign_bit = type{1} << (8 * sizeof(K) - 1);
+        type u{};
+        std::memcpy(&u, &k, sizeof(K));
+        return u ^ ((u & sign_bit) ? ~type{0} : sign_bit);
+    }
+};
+
+template <typename K>
+using radix_key_t = typename radix_key<K>::type;
+
+template <typename I, typename Proj>
+using radix_projected_t = remove_cvref_t<indirect_result_t<Proj&, I>>;
+
+// Whether ranges of I can be radix sorted by their projected keys: Comp must
+// order them in the same way as radix_key<K> (less), or the reverse (greater)
+template <typename I, typename Comp, typename Proj,
+          typename K = radix_projected_t<I, Proj>>
+constexpr bool radix_sortable =
+    exists_v<radix_key_t, K> &&
+    (is_less<std::remove_const_t<Comp>, K>::value ||
+     is_greater<std::remove_const_t<Comp>, K>::value);
+
+// Projection returning the (possibly inverted) radix key of an element
+template <typename K, bool Descending, typename Proj>
+struct radix_key_fn {
+    using key_type = radix_key_t<K>;
+
+    Proj& proj;
+
+    template <typename T>
+    key_type operator()(T&& t) const
+    {
+        const key_type k = radix_key<K>::get(nano::invoke(proj, std::forward<T>(t)));
+        return Descending ? key_type(~k) : k;
+    }
+};
+
+template <typename U>
+constexpr unsigned radix_digit(U key, int byte) noexcept
+{
+    return static_cast<unsigned>((key >> (8 * byte)) & 0xFF);
+}
+
+// Counts the occurrences of each value of each digit of the keys in
+// [first, first + n)
+template <typename I, typename KeyFn, std::size_t NumDigits>
+void radix_count_digits(I first, iter_difference_t<I> n, KeyFn& key,
+                        iter_difference_t<I> (&counts)[NumDigits][256])
+{
+    for (iter_difference_t<I> i = 0; i < n; ++i, ++first) {
+        const auto k = key(*first);
+        for (std::size_t d = 0; d < NumDigits; ++d) {
+            ++counts[d][detail::radix_digit(k, int(d))];
+        }
+    }
+}
+
+// Least-significant-digit-first radix sort, moving elements back and forth
+// between [first, first + n) and the buffer, given the digit counts for the
+// range. Digits on which all keys agree are skipped.
+template <typename I, typename T, typename KeyFn, std::size_t NumDigits>
+void lsd_radix_sort(I first, iter_difference_t<I> n, T* buf, KeyFn& key,
+                    iter_difference_t<I> (&counts)[NumDigits][256])
+{
+    using diff_t = iter_difference_t<I>;
+
+    bool in_buf = false;
+
+    for (std::size_t d = 0; d < NumDigits; ++d) {
+        diff_t* count = counts[d];
+
+        bool trivial = false;
+        diff_t sum = 0;
+        for (int b = 0; b < 256; ++b) {
+            trivial = trivial || count[b] == n;
+            const diff_t c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+
+        if (trivial) {
+            continue;
+        }
+
+        if (!in_buf) {
+            I it = first;
+            for (diff_t i = 0; i < n; ++i, ++it) {
+                buf[count[detail::radix_digit(key(*it), int(d))]++] =
+                    nano::iter_move(it);
+            }
+        } else {
+            for (diff_t i = 0; i < n; ++i) {
+                *(first + count[detail::radix_digit(key(buf[i]), int(d))]++) =
+                    std::move(buf[i]);
+            }
+        }
+
+        in_buf = !in_buf;
+    }
+
+    if (in_buf) {
+        for (diff_t i = 0; i < n; ++i, ++first) {
+            *first = std::move(buf[i]);
+        }
+    }
+}
+
+// In-place most-significant-digit-first radix sort, permuting each bucket
+// into place by following cycles (the "American flag" sort of McIlroy,
+// Bostic and McIlroy). Small buckets are handed off to pdqsort.
+template <typename I, typename KeyFn>
+void american_flag_sort(I first, I last, int digit, KeyFn& key)
+{
+    using diff_t = iter_difference_t<I>;
+
+    while (true) {
+        const diff_t n = last - first;
+
+        if (n < american_flag_sort_threshold) {
+            nano::less<> comp{};
+            detail::pdqsort(std::move(first), std::move(last), comp, key);
+            return;
+        }
+
+        diff_t counts[256] = {};
+        for (I it = first; it != last; ++it) {
+            ++counts[detail::radix_digit(key(*it), digit)];
+        }
+
+        // If every key has the same digit, move straight on to the next one
+        bool trivial = false;
+        for (int b = 0; b < 256; ++b) {
+            trivial = trivial || counts[b] == n;
+        }
+        if (trivial) {
+            if (digit-- == 0) {
+                return;
+            }
+            continue;
+        }
+
+        diff_t heads[256];
+        diff_t tails[256];
+        diff_t sum = 0;
+        for (int b = 0; b < 256; ++b) {
+            heads[b] = sum;
+            sum += counts[b];
+            tails[b] = sum;
+        }
+
+        for (unsigned b = 0; b < 256; ++b) {
+            while (heads[b] < tails[b]) {
+                I it = first + heads[b];
+                const unsigned d = detail::radix_digit(key(*it), digit);
+                if (d == b) {
+                    ++heads[b];
+                } else {
+                    nano::iter_swap(it, first + heads[d]++);
+                }
+            }
+        }
+
+        if (digit == 0) {
+            return;
+        }
+
+        diff_t start = 0;
+        for (int b = 0; b < 256; ++b) {
+            if (counts[b] > 1) {
+                detail::american_flag_sort(first + start,
+                                           first + (start + counts[b]),
+                                           digit - 1, key);
+            }
+            start += counts[b];
+        }
+        return;
+    }
+}
+
+// Sorts [first, last) by the arithmetic key nano::invoke(proj, *it),
+// according to Comp (which must satisfy radix_sortable).
+//
+// The LSD sort makes one pass over the data for every digit which is not the
+// same for all keys, while the American flag sort only needs to go deep
+// enough for the buckets to become small. We pick whichever should make fewer
+// passes, preferring the LSD sort on a tie as its passes are cheaper. We also
+// fall back to the American flag sort if we can't get enough memory for a
+// buffer.
+template <typename I, typename Comp, typename Proj>
+void radix_sort(I first, I last, Comp&, Proj& proj)
+{
+    using K = radix_projected_t<I, Proj>;
+    using diff_t = iter_difference_t<I>;
+    constexpr bool descending = is_greater<std::remove_const_t<Comp>, K>::value;
+    constexpr int num_digits = sizeof(radix_key_t<K>);
+
+    radix_key_fn<K, descending, Proj> key{proj};
+    const diff_t n = last - first;
+
+    diff_t counts[num_digits][256] = {};
+    detail::radix_count_digits(first, n, key, counts);
+
+    int lsd_passes = 0;
+    for (int d = 0; d < num_digits; ++d) {
+        lsd_passes += std::find(counts[d], counts[d] + 256, n) == counts[d] + 256;
+    }
+
+    // If every digit is the same for all keys, the keys are all equal
+    if (lsd_passes == 0) {
+        return;
+    }
+
+    int msd_passes = 2;
+    for (diff_t m = n / american_flag_sort_threshold; m > 0; m /= 256) {
+        ++msd_passes;
+    }
+
+    if (lsd_passes <= msd_passes) {
+        temporary_buffer<iter_value_t<I>> buf(n, first);
+        if (buf.size() == n) {
+            detail::lsd_radix_sort(std::move(first), n, buf.begin(), key,
+                                   counts);
+            return;
+        }
+    }
+
+    detail::american_flag_sort(std::move(first), std::move(last),
+                               num_digits - 1, key);
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
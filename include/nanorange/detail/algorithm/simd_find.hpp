@@ -0,0 +1,263 @@
+// nanorange/detail/algorithm/simd_find.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_FIND_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_FIND_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/simd_search.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::simd_find, detail::simd_mismatch, detail::simd_equal and
+// detail::simd_lexicographical_compare
+// (memchr, memcmp and vectorised kernels for find, mismatch, equal and
+// lexicographical_compare)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether values of T are equal exactly when their object representations
+// are, so that ranges of them can be compared byte by byte
+template <typename T>
+constexpr bool bytewise_equality_comparable =
+    (std::is_integral<T>::value || std::is_enum<T>::value ||
+     std::is_pointer<T>::value) &&
+    !std::is_volatile<T>::value &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+// Whether find for a contiguous range of T may use simd_find() to look for
+// a value of type U. Other integral types are fine, so long as the value
+// passes simd_find_value_in_range().
+template <typename T, typename U>
+constexpr bool simd_findable =
+    bytewise_equality_comparable<T> &&
+    (std::is_same<T, U>::value ||
+     (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+      std::is_integral<U>::value && !std::is_same<U, bool>::value));
+
+// Whether the elements of a range of V which compare equal to value are
+// exactly those whose object representation is that of static_cast<V>(value).
+// If not, none of them can compare equal to it. For integers, == converts
+// both sides to a common type C, which can represent every value of V, so we
+// check that value is unchanged by converting it to V before C. This rules
+// out values which are out of range for V, but also (for instance) 255 when
+// V is signed char, or -1 when V is unsigned char: -1 and 255 compare unequal
+// after promotion to int, although they have the same representation.
+template <typename V, typename T>
+constexpr bool simd_find_value_in_range(const T&, std::false_type)
+{
+    return true;
+}
+
+template <typename V, typename T>
+constexpr bool simd_find_value_in_range(const T& value, std::true_type)
+{
+    using C = decltype(std::declval<V>() + std::declval<T>());
+    return static_cast<C>(static_cast<V>(value)) == static_cast<C>(value);
+}
+
+template <typename V, typename T>
+constexpr bool simd_find_value_in_range(const T& value)
+{
+    return detail::simd_find_value_in_range<V>(
+        value, std::integral_constant<bool, std::is_integral<V>::value &&
+                                                std::is_integral<T>::value>{});
+}
+
+// Whether equal and mismatch for contiguous ranges of T1 and T2, compared
+// using Pred, may use simd_equal() and simd_mismatch()
+template <typename T1, typename T2, typename Pred>
+constexpr bool simd_equal_comparable =
+    std::is_same<std::remove_const_t<T1>, std::remove_const_t<T2>>::value &&
+    bytewise_equality_comparable<std::remove_const_t<T1>> &&
+    is_equal_to<std::remove_const_t<Pred>, std::remove_const_t<T1>>::value;
+
+// Whether lexicographical_compare for contiguous ranges of T1 and T2,
+// compared using Comp, may use simd_lexicographical_compare()
+template <typename T1, typename T2, typename Comp>
+constexpr bool simd_lexicographically_comparable =
+    std::is_same<std::remove_const_t<T1>, std::remove_const_t<T2>>::value &&
+    std::is_integral<std::remove_const_t<T1>>::value &&
+    bytewise_equality_comparable<std::remove_const_t<T1>> &&
+    is_less<std::remove_const_t<Comp>, std::remove_const_t<T1>>::value;
+
+#ifdef NANO_HAVE_SSE2
+
+// Returns value repeated across a vector
+template <typename T>
+__m128i simd_broadcast(const T& value)
+{
+    unsigned char bytes[16];
+    for (std::size_t k = 0; k < 16; k += sizeof(T)) {
+        std::memcpy(bytes + k, &value, sizeof(T));
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+}
+
+// Returns a vector whose lanes are all ones where the N-byte elements of a and
+// b are equal, and zero elsewhere
+template <std::size_t N>
+__m128i simd_equal_lanes(__m128i a, __m128i b)
+{
+    if (N == 1) {
+        return _mm_cmpeq_epi8(a, b);
+    } else if (N == 2) {
+        return _mm_cmpeq_epi16(a, b);
+    } else if (N == 4) {
+        return _mm_cmpeq_epi32(a, b);
+    }
+    // SSE2 has no 64-bit comparison, so we require both halves to match
+    const __m128i halves = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(halves,
+                         _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+// Returns a mask with a bit for each byte of a and b, which is set for all
+// the bytes of the N-byte elements which are equal
+template <std::size_t N>
+unsigned simd_equal_mask(__m128i a, __m128i b)
+{
+    return static_cast<unsigned>(
+        _mm_movemask_epi8(detail::simd_equal_lanes<N>(a, b)));
+}
+
+#endif // NANO_HAVE_SSE2
+
+// Returns the first element of [first, last) equal to value, or last if
+// there is none, using memchr for bytes and otherwise comparing sixteen
+// bytes at a time
+template <typename T>
+T* simd_find(T* first, T* last, std::remove_const_t<T> value)
+{
+    const std::ptrdiff_t n = last - first;
+    if (n == 0) {
+        return last;
+    }
+
+    const auto bytes = reinterpret_cast<const unsigned char*>(first);
+
+    if (sizeof(T) == 1) {
+        unsigned char byte;
+        std::memcpy(&byte, &value, 1);
+        const auto pos = static_cast<const unsigned char*>(
+            std::memchr(bytes, byte, static_cast<std::size_t>(n)));
+        return pos ? first + (pos - bytes) : last;
+    }
+
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAVE_SSE2
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    const __m128i needle = detail::simd_broadcast(value);
+
+    for (; n - i >= lanes; i += lanes) {
+        const __m128i block = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(bytes + i * sizeof(T)));
+        const unsigned mask =
+            detail::simd_equal_mask<sizeof(T)>(block, needle);
+        if (mask != 0) {
+            return first + (i + detail::simd_first_bit(mask) /
+                                    static_cast<int>(sizeof(T)));
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (first[i] == value) {
+            return first + i;
+        }
+    }
+
+    return last;
+}
+
+// Returns the position of the first of the n elements starting at first1
+// and first2 which differ, or n if there is none, comparing sixteen bytes at
+// a time
+template <typename T1, typename T2>
+std::ptrdiff_t simd_mismatch(T1* first1, T2* first2, std::ptrdiff_t n)
+{
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAVE_SSE2
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T1);
+    const auto bytes1 = reinterpret_cast<const unsigned char*>(first1);
+    const auto bytes2 = reinterpret_cast<const unsigned char*>(first2);
+
+    for (; n - i >= lanes; i += lanes) {
+        const __m128i a = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(bytes1 + i * sizeof(T1)));
+        const __m128i b = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(bytes2 + i * sizeof(T1)));
+        const unsigned mask =
+            static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) ^
+            0xFFFFu;
+        if (mask != 0) {
+            return i + detail::simd_first_bit(mask) /
+                           static_cast<int>(sizeof(T1));
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (!(first1[i] == first2[i])) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+// Returns whether the n elements starting at first1 and first2 are equal
+template <typename T1, typename T2>
+bool simd_equal(T1* first1, T2* first2, std::ptrdiff_t n)
+{
+    return n == 0 || std::memcmp(first1, first2,
+                                 static_cast<std::size_t>(n) * sizeof(T1)) == 0;
+}
+
+// Returns whether [first1, last1) is lexicographically less than
+// [first2, last2), using memcmp for unsigned bytes (which it compares in
+// just the right order), and otherwise finding the first mismatch
+template <typename T1, typename T2>
+bool simd_lexicographical_compare(T1* first1, T1* last1, T2* first2,
+                                  T2* last2)
+{
+    const std::ptrdiff_t n1 = last1 - first1;
+    const std::ptrdiff_t n2 = last2 - first2;
+    const std::ptrdiff_t n = n1 < n2 ? n1 : n2;
+
+    if (std::is_unsigned<std::remove_const_t<T1>>::value && sizeof(T1) == 1) {
+        const int res = n == 0 ? 0 : std::memcmp(first1, first2,
+                                                 static_cast<std::size_t>(n));
+        if (res != 0) {
+            return res < 0;
+        }
+    } else {
+        const std::ptrdiff_t i = detail::simd_mismatch(first1, first2, n);
+        if (i != n) {
+            return first1[i] < first2[i];
+        }
+    }
+
+    return n1 < n2;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
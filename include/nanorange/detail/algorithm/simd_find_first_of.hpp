@@ -0,0 +1,155 @@
+// nanorange/detail/algorithm/simd_find_first_of.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_FIND_FIRST_OF_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_FIND_FIRST_OF_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/simd_search.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::byte_set and detail::simd_find_first_of
+// (lookup table and vectorised kernel for find_first_of)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether find_first_of for elements of T1 and T2, compared using Pred, may
+// look them up in a byte_set
+template <typename T1, typename T2, typename Pred>
+constexpr bool byte_set_searchable =
+    simd_byte_type<T1> && std::is_same<T1, T2>::value &&
+    is_equal_to<std::remove_const_t<Pred>, T1>::value;
+
+// The set of values of a range of bytes, as a table indexed by value. The
+// first few distinct values are also kept in order, so that small sets can
+// be compared against a whole block of bytes at once.
+struct byte_set {
+    static constexpr int max_values = 16;
+
+    bool contains[256];
+    unsigned char values[max_values];
+    int size;
+};
+
+template <typename I, typename S>
+constexpr byte_set make_byte_set(I first, S last)
+{
+    byte_set set{};
+
+    for (; first != last; ++first) {
+        const auto b = static_cast<unsigned char>(*first);
+        if (!set.contains[b]) {
+            set.contains[b] = true;
+            if (set.size < byte_set::max_values) {
+                set.values[set.size] = b;
+            }
+            ++set.size;
+        }
+    }
+
+    return set;
+}
+
+#ifdef NANO_HAVE_SSE2
+
+// Returns a mask of the bytes of block equal to any of eight values, each
+// repeated across one of v
+inline unsigned simd_find_first_of_mask(__m128i block, const __m128i* v)
+{
+    const __m128i a = _mm_or_si128(_mm_cmpeq_epi8(block, v[0]),
+                                   _mm_cmpeq_epi8(block, v[1]));
+    const __m128i b = _mm_or_si128(_mm_cmpeq_epi8(block, v[2]),
+                                   _mm_cmpeq_epi8(block, v[3]));
+    const __m128i c = _mm_or_si128(_mm_cmpeq_epi8(block, v[4]),
+                                   _mm_cmpeq_epi8(block, v[5]));
+    const __m128i d = _mm_or_si128(_mm_cmpeq_epi8(block, v[6]),
+                                   _mm_cmpeq_epi8(block, v[7]));
+    return static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))));
+}
+
+// Compares sixteen bytes at a time against Groups groups of eight values
+// (padded by repeating members of the set). Returns the position of the
+// first match, or how far it got if there is none.
+template <int Groups>
+std::ptrdiff_t simd_find_first_of_blocks(const unsigned char* bytes,
+                                         std::ptrdiff_t n,
+                                         const unsigned char* values)
+{
+    __m128i v[8 * Groups];
+    for (int k = 0; k < 8 * Groups; ++k) {
+        v[k] = _mm_set1_epi8(static_cast<char>(values[k]));
+    }
+
+    std::ptrdiff_t i = 0;
+    for (; n - i >= 16; i += 16) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        unsigned mask = detail::simd_find_first_of_mask(block, v);
+        if (Groups > 1) {
+            mask |= detail::simd_find_first_of_mask(block, v + 8);
+        }
+        if (mask != 0) {
+            return i + detail::simd_first_bit(mask);
+        }
+    }
+
+    return i;
+}
+
+#endif // NANO_HAVE_SSE2
+
+// Returns the first element of [first, last) which is a member of set, or
+// last if there is none. If set has at most max_values members, we compare
+// sixteen bytes at a time against each of them; otherwise we look up each
+// byte in turn.
+template <typename T>
+T* simd_find_first_of(T* first, T* last, const byte_set& set)
+{
+    if (set.size == 0) {
+        return last;
+    }
+
+    const auto bytes = reinterpret_cast<const unsigned char*>(first);
+    const std::ptrdiff_t n = last - first;
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAVE_SSE2
+    if (set.size <= byte_set::max_values) {
+        unsigned char values[byte_set::max_values];
+        for (int k = 0; k < byte_set::max_values; ++k) {
+            values[k] = set.values[k < set.size ? k : 0];
+        }
+
+        i = set.size <= 8
+                ? detail::simd_find_first_of_blocks<1>(bytes, n, values)
+                : detail::simd_find_first_of_blocks<2>(bytes, n, values);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (set.contains[bytes[i]]) {
+            return first + i;
+        }
+    }
+
+    return last;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
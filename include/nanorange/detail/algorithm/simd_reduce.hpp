@@ -0,0 +1,493 @@
+// nanorange/detail/algorithm/simd_reduce.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_REDUCE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_REDUCE_HPP_INCLUDED
+
+#include <nanorange/detail/algorithm/simd_find.hpp>
+#include <nanorange/detail/functional/identity.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::simd_min_element, detail::simd_max_element,
+// detail::simd_minmax_element, detail::simd_is_sorted_until and
+// detail::simd_count
+// (vectorised reductions for min_element, max_element, minmax_element,
+// is_sorted_until and count)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether T is an arithmetic type which SSE2 can compare with <
+template <typename T>
+constexpr bool simd_arithmetic =
+    (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+     sizeof(T) <= 4) ||
+    std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+// Whether min_element, max_element, minmax_element and is_sorted_until for a
+// contiguous range of T, compared using Comp and projected using Proj, may
+// use the kernels below
+template <typename T, typename Comp, typename Proj>
+constexpr bool simd_orderable =
+#ifdef NANO_HAVE_SSE2
+    simd_arithmetic<std::remove_const_t<T>> &&
+    is_less<std::remove_const_t<Comp>, std::remove_const_t<T>>::value &&
+    std::is_same<std::remove_const_t<Proj>, identity>::value;
+#else
+    false;
+#endif
+
+// Whether count for a contiguous range of T, projected using Proj, may use
+// simd_count() to count the elements equal to a value of type U
+template <typename T, typename U, typename Proj>
+constexpr bool simd_countable =
+#ifdef NANO_HAVE_SSE2
+    std::is_same<std::remove_const_t<Proj>, identity>::value &&
+    (simd_findable<std::remove_const_t<T>, U> ||
+     ((std::is_same<std::remove_const_t<T>, float>::value ||
+       std::is_same<std::remove_const_t<T>, double>::value) &&
+      std::is_same<std::remove_const_t<T>, U>::value));
+#else
+    false;
+#endif
+
+#ifdef NANO_HAVE_SSE2
+
+// Takes the lanes of a where mask is set, and those of b elsewhere
+inline __m128i simd_select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Operations on vectors of sixteen bytes' worth of elements of T
+template <typename T, typename = void>
+struct simd_ops;
+
+// Integers, enums and pointers. SSE2 only has signed comparisons of 8, 16 and
+// 32-bit integers, so unsigned values have their sign bits flipped before
+// comparing them; other types may only be compared for equality.
+template <typename T>
+struct simd_ops<T, std::enable_if_t<bytewise_equality_comparable<T>>> {
+    static constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+
+    static __m128i load(const T* p)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    // The lanes in which a is less than b
+    static __m128i less(__m128i a, __m128i b)
+    {
+        if (std::is_unsigned<T>::value) {
+            const __m128i bias = detail::simd_broadcast(
+                static_cast<T>(T(1) << (8 * sizeof(T) - 1)));
+            a = _mm_xor_si128(a, bias);
+            b = _mm_xor_si128(b, bias);
+        }
+
+        if (sizeof(T) == 1) {
+            return _mm_cmplt_epi8(a, b);
+        } else if (sizeof(T) == 2) {
+            return _mm_cmplt_epi16(a, b);
+        }
+        return _mm_cmplt_epi32(a, b);
+    }
+
+    // The lesser and greater of each lane of a and b
+    static __m128i min(__m128i a, __m128i b)
+    {
+        if (sizeof(T) == 1 && std::is_unsigned<T>::value) {
+            return _mm_min_epu8(a, b);
+        } else if (sizeof(T) == 2 && std::is_signed<T>::value) {
+            return _mm_min_epi16(a, b);
+        }
+        return detail::simd_select(less(a, b), a, b);
+    }
+
+    static __m128i max(__m128i a, __m128i b)
+    {
+        if (sizeof(T) == 1 && std::is_unsigned<T>::value) {
+            return _mm_max_epu8(a, b);
+        } else if (sizeof(T) == 2 && std::is_signed<T>::value) {
+            return _mm_max_epi16(a, b);
+        }
+        return detail::simd_select(less(a, b), b, a);
+    }
+
+    // The lanes which are NaN
+    static __m128i unordered(__m128i) { return _mm_setzero_si128(); }
+
+    // The lanes in which a and b are equal
+    static __m128i equal(__m128i a, __m128i b)
+    {
+        return detail::simd_equal_lanes<sizeof(T)>(a, b);
+    }
+};
+
+template <>
+struct simd_ops<float> {
+    static constexpr std::ptrdiff_t lanes = 4;
+
+    static __m128i load(const float* p)
+    {
+        return _mm_castps_si128(_mm_loadu_ps(p));
+    }
+
+    static __m128i less(__m128i a, __m128i b)
+    {
+        return _mm_castps_si128(
+            _mm_cmplt_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+
+    // Either operand may be returned for lanes which are equal or NaN
+    static __m128i min(__m128i a, __m128i b)
+    {
+        return _mm_castps_si128(
+            _mm_min_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+
+    static __m128i max(__m128i a, __m128i b)
+    {
+        return _mm_castps_si128(
+            _mm_max_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+
+    static __m128i unordered(__m128i a)
+    {
+        return _mm_castps_si128(
+            _mm_cmpunord_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(a)));
+    }
+
+    static __m128i equal(__m128i a, __m128i b)
+    {
+        return _mm_castps_si128(
+            _mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+};
+
+template <>
+struct simd_ops<double> {
+    static constexpr std::ptrdiff_t lanes = 2;
+
+    static __m128i load(const double* p)
+    {
+        return _mm_castpd_si128(_mm_loadu_pd(p));
+    }
+
+    static __m128i less(__m128i a, __m128i b)
+    {
+        return _mm_castpd_si128(
+            _mm_cmplt_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+
+    // Either operand may be returned for lanes which are equal or NaN
+    static __m128i min(__m128i a, __m128i b)
+    {
+        return _mm_castpd_si128(
+            _mm_min_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+
+    static __m128i max(__m128i a, __m128i b)
+    {
+        return _mm_castpd_si128(
+            _mm_max_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+
+    static __m128i unordered(__m128i a)
+    {
+        return _mm_castpd_si128(
+            _mm_cmpunord_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(a)));
+    }
+
+    static __m128i equal(__m128i a, __m128i b)
+    {
+        return _mm_castpd_si128(
+            _mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+};
+
+// Finds the least (if Min) and greatest (if Max) of the n elements starting
+// at first, where n is at least one vector's worth, sixteen bytes at a time.
+// Returns false without doing so if any of them is NaN.
+template <bool Min, bool Max, typename T>
+bool simd_min_max(const T* first, std::ptrdiff_t n, T& min, T& max)
+{
+    using ops = simd_ops<T>;
+    constexpr std::ptrdiff_t lanes = ops::lanes;
+
+    // Two sets of accumulators, so that consecutive blocks need not wait for
+    // each other
+    __m128i block = ops::load(first);
+    __m128i vmin[2] = {block, block};
+    __m128i vmax[2] = {block, block};
+    __m128i nan = ops::unordered(block);
+
+    const auto update = [&](int k, __m128i b) {
+        if (Min) {
+            vmin[k] = ops::min(vmin[k], b);
+        }
+        if (Max) {
+            vmax[k] = ops::max(vmax[k], b);
+        }
+        nan = _mm_or_si128(nan, ops::unordered(b));
+    };
+
+    std::ptrdiff_t i = lanes;
+    for (; n - i >= 2 * lanes; i += 2 * lanes) {
+        update(0, ops::load(first + i));
+        update(1, ops::load(first + i + lanes));
+    }
+    if (n - i >= lanes) {
+        update(0, ops::load(first + i));
+        i += lanes;
+    }
+    // The last block may overlap the one before it, which makes no
+    // difference to the result
+    if (i != n) {
+        update(1, ops::load(first + n - lanes));
+    }
+
+    if (_mm_movemask_epi8(nan) != 0) {
+        return false;
+    }
+
+    T mins[lanes];
+    T maxs[lanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(mins),
+                     ops::min(vmin[0], vmin[1]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxs),
+                     ops::max(vmax[0], vmax[1]));
+
+    min = mins[0];
+    max = maxs[0];
+    for (std::ptrdiff_t k = 1; k < lanes; ++k) {
+        if (mins[k] < min) {
+            min = mins[k];
+        }
+        if (max < maxs[k]) {
+            max = maxs[k];
+        }
+    }
+
+    return true;
+}
+
+// Returns the position of the first of the n elements starting at first
+// which is equal to value, which must be present
+template <typename T>
+std::ptrdiff_t simd_find_first_equal(const T* first, std::ptrdiff_t n,
+                                     const T& value)
+{
+    using ops = simd_ops<T>;
+    const __m128i needle = detail::simd_broadcast(value);
+
+    std::ptrdiff_t i = 0;
+    for (; n - i >= ops::lanes; i += ops::lanes) {
+        const auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8(ops::equal(ops::load(first + i), needle)));
+        if (mask != 0) {
+            return i + detail::simd_first_bit(mask) /
+                           static_cast<int>(sizeof(T));
+        }
+    }
+
+    while (!(first[i] == value)) {
+        ++i;
+    }
+    return i;
+}
+
+// Returns the position of the last of the n elements starting at first
+// which is equal to value, which must be present
+template <typename T>
+std::ptrdiff_t simd_find_last_equal(const T* first, std::ptrdiff_t n,
+                                    const T& value)
+{
+    using ops = simd_ops<T>;
+    const __m128i needle = detail::simd_broadcast(value);
+
+    std::ptrdiff_t i = n;
+    for (; i >= ops::lanes; i -= ops::lanes) {
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(
+            ops::equal(ops::load(first + i - ops::lanes), needle)));
+        if (mask != 0) {
+            return i - ops::lanes + detail::simd_last_bit(mask) /
+                                        static_cast<int>(sizeof(T));
+        }
+    }
+
+    do {
+        --i;
+    } while (!(first[i] == value));
+    return i;
+}
+
+#endif // NANO_HAVE_SSE2
+
+// Returns the first least element of [first, last), or last if it is empty.
+// The least value is found sixteen bytes at a time, and then the first
+// element equal to it. Ranges containing NaNs are left to the plain loop.
+template <typename T>
+T* simd_min_element(T* first, T* last)
+{
+#ifdef NANO_HAVE_SSE2
+    using V = std::remove_const_t<T>;
+    const std::ptrdiff_t n = last - first;
+    V min, max;
+    if (n >= simd_ops<V>::lanes &&
+        detail::simd_min_max<true, false>(first, n, min, max)) {
+        return first + detail::simd_find_first_equal(first, n, min);
+    }
+#endif
+
+    T* result = first;
+    for (T* i = first; i != last; ++i) {
+        if (*i < *result) {
+            result = i;
+        }
+    }
+    return result;
+}
+
+// Returns the last greatest element of [first, last), or last if it is
+// empty, in the same way as simd_min_element()
+template <typename T>
+T* simd_max_element(T* first, T* last)
+{
+#ifdef NANO_HAVE_SSE2
+    using V = std::remove_const_t<T>;
+    const std::ptrdiff_t n = last - first;
+    V min, max;
+    if (n >= simd_ops<V>::lanes &&
+        detail::simd_min_max<false, true>(first, n, min, max)) {
+        return first + detail::simd_find_last_equal(first, n, max);
+    }
+#endif
+
+    T* result = first;
+    for (T* i = first; i != last; ++i) {
+        if (!(*i < *result)) {
+            result = i;
+        }
+    }
+    return result;
+}
+
+// Finds the first least and last greatest elements of [first, last), in the
+// same way as simd_min_element(). Returns false, leaving min and max alone,
+// if the range is too short to be worth it or contains a NaN, in which case
+// the caller must fall back to its own algorithm.
+template <typename T>
+bool simd_minmax_element(T* first, T* last, T*& min, T*& max)
+{
+#ifdef NANO_HAVE_SSE2
+    using V = std::remove_const_t<T>;
+    const std::ptrdiff_t n = last - first;
+    V min_value, max_value;
+    if (n >= simd_ops<V>::lanes &&
+        detail::simd_min_max<true, true>(first, n, min_value, max_value)) {
+        min = first + detail::simd_find_first_equal(first, n, min_value);
+        max = first + detail::simd_find_last_equal(first, n, max_value);
+        return true;
+    }
+#else
+    (void) first;
+    (void) last;
+    (void) min;
+    (void) max;
+#endif
+
+    return false;
+}
+
+// Returns the first element of [first, last) which is less than the one
+// before it, or last if there is none, comparing sixteen bytes' worth of
+// neighbouring pairs at a time
+template <typename T>
+T* simd_is_sorted_until(T* first, T* last)
+{
+    const std::ptrdiff_t n = last - first;
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAVE_SSE2
+    using V = std::remove_const_t<T>;
+    using ops = simd_ops<V>;
+
+    for (; n - 1 - i >= ops::lanes; i += ops::lanes) {
+        const __m128i cur = ops::load(first + i);
+        const __m128i next = ops::load(first + i + 1);
+        const auto mask =
+            static_cast<unsigned>(_mm_movemask_epi8(ops::less(next, cur)));
+        if (mask != 0) {
+            return first + (i + 1 + detail::simd_first_bit(mask) /
+                                        static_cast<int>(sizeof(T)));
+        }
+    }
+#endif
+
+    for (; i + 1 < n; ++i) {
+        if (first[i + 1] < first[i]) {
+            return first + (i + 1);
+        }
+    }
+
+    return last;
+}
+
+// Returns the number of elements of [first, last) equal to value, comparing
+// sixteen bytes at a time. Each match adds one to each of its bytes in an
+// accumulator, which is summed before any of them can overflow.
+template <typename T>
+std::ptrdiff_t simd_count(T* first, T* last, std::remove_const_t<T> value)
+{
+    const std::ptrdiff_t n = last - first;
+    std::ptrdiff_t count = 0;
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAVE_SSE2
+    using ops = simd_ops<std::remove_const_t<T>>;
+    const __m128i needle = detail::simd_broadcast(value);
+    const __m128i zero = _mm_setzero_si128();
+
+    std::ptrdiff_t bytes = 0;
+    while (n - i >= ops::lanes) {
+        const std::ptrdiff_t blocks = (n - i) / ops::lanes < 255
+                                          ? (n - i) / ops::lanes
+                                          : 255;
+        __m128i acc = zero;
+        for (std::ptrdiff_t k = 0; k < blocks; ++k, i += ops::lanes) {
+            acc = _mm_sub_epi8(acc, ops::equal(ops::load(first + i), needle));
+        }
+        const __m128i sums = _mm_sad_epu8(acc, zero);
+        bytes += _mm_cvtsi128_si32(sums) +
+                 _mm_cvtsi128_si32(_mm_unpackhi_epi64(sums, sums));
+    }
+    count = bytes / static_cast<std::ptrdiff_t>(sizeof(T));
+#endif
+
+    for (; i < n; ++i) {
+        if (first[i] == value) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,208 @@
+// nanorange/detail/algorithm/simd_search.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_SEARCH_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_SEARCH_HPP_INCLUDED
+
+#include <nanorange/detail/functional/comparisons.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::simd_search and detail::simd_search_last
+// (vectorised kernels for search and find_end)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether T is a character-like type, whose values are equal exactly when
+// their object representations are
+template <typename T>
+constexpr bool simd_byte_type =
+    std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+    sizeof(T) == 1;
+
+// Whether search and find_end for contiguous ranges of T1 and T2, compared
+// using Pred, may use simd_search() and simd_search_last()
+template <typename T1, typename T2, typename Pred>
+constexpr bool simd_searchable =
+#ifdef NANO_HAVE_SSE2
+    simd_byte_type<std::remove_const_t<T1>> &&
+    std::is_same<std::remove_const_t<T1>, std::remove_const_t<T2>>::value &&
+    is_equal_to<std::remove_const_t<Pred>, std::remove_const_t<T1>>::value;
+#else
+    false;
+#endif
+
+// Returns the position of the lowest set bit of mask, which is not zero
+inline int simd_first_bit(unsigned mask) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int bit = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+// Returns the position of the highest set bit of mask, which is not zero
+inline int simd_last_bit(unsigned mask) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int>(8 * sizeof(unsigned) - 1) - __builtin_clz(mask);
+#else
+    int bit = -1;
+    while (mask != 0) {
+        mask >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+// Whether the needle of length m (at least 1) occurs at hay
+inline bool simd_search_match(const unsigned char* hay,
+                              const unsigned char* needle,
+                              std::ptrdiff_t m) noexcept
+{
+    return hay[0] == needle[0] && hay[m - 1] == needle[m - 1] &&
+           (m <= 2 ||
+            std::memcmp(hay + 1, needle + 1, static_cast<std::size_t>(m - 2)) == 0);
+}
+
+#ifdef NANO_HAVE_SSE2
+
+// Returns a mask of those of the sixteen positions starting at hay at which
+// the needle of length m has the right first and last bytes, given those
+// bytes repeated in first and last
+inline unsigned simd_search_candidates(const unsigned char* hay,
+                                       std::ptrdiff_t m, __m128i first,
+                                       __m128i last) noexcept
+{
+    const __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay));
+    const __m128i block_last =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + m - 1));
+    return static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(block_first, first),
+                      _mm_cmpeq_epi8(block_last, last))));
+}
+
+#endif // NANO_HAVE_SSE2
+
+// Returns the first occurrence of [first2, last2) in [first1, last1), or
+// last1 if there is none. Sixteen positions at a time, we compare the first
+// and last bytes of the needle with the haystack, and only compare the rest
+// at positions where both match (Muła, "SIMD-friendly algorithms for
+// substring searching", 2016).
+template <typename T1, typename T2>
+T1* simd_search(T1* first1, T1* last1, T2* first2, T2* last2)
+{
+    const std::ptrdiff_t n = last1 - first1;
+    const std::ptrdiff_t m = last2 - first2;
+
+    if (m == 0) {
+        return first1;
+    }
+    if (m > n) {
+        return last1;
+    }
+
+    const auto hay = reinterpret_cast<const unsigned char*>(first1);
+    const auto needle = reinterpret_cast<const unsigned char*>(first2);
+
+    // The number of positions at which the needle might start
+    const std::ptrdiff_t positions = n - m + 1;
+    std::ptrdiff_t i = 0;
+
+#ifdef NANO_HAVE_SSE2
+    const __m128i first = _mm_set1_epi8(static_cast<char>(needle[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(needle[m - 1]));
+
+    for (; positions - i >= 16; i += 16) {
+        unsigned mask = detail::simd_search_candidates(hay + i, m, first, last);
+        while (mask != 0) {
+            const int bit = detail::simd_first_bit(mask);
+            if (detail::simd_search_match(hay + i + bit, needle, m)) {
+                return first1 + (i + bit);
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < positions; ++i) {
+        if (detail::simd_search_match(hay + i, needle, m)) {
+            return first1 + i;
+        }
+    }
+
+    return last1;
+}
+
+// Returns the last occurrence of [first2, last2) in [first1, last1), or
+// last1 if there is none, in the same way as simd_search() but working
+// backwards from the end
+template <typename T1, typename T2>
+T1* simd_search_last(T1* first1, T1* last1, T2* first2, T2* last2)
+{
+    const std::ptrdiff_t n = last1 - first1;
+    const std::ptrdiff_t m = last2 - first2;
+
+    if (m == 0 || m > n) {
+        return last1;
+    }
+
+    const auto hay = reinterpret_cast<const unsigned char*>(first1);
+    const auto needle = reinterpret_cast<const unsigned char*>(first2);
+
+    // One past the last position at which the needle might start
+    std::ptrdiff_t i = n - m + 1;
+
+#ifdef NANO_HAVE_SSE2
+    const __m128i first = _mm_set1_epi8(static_cast<char>(needle[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(needle[m - 1]));
+
+    for (; i >= 16; i -= 16) {
+        unsigned mask =
+            detail::simd_search_candidates(hay + i - 16, m, first, last);
+        while (mask != 0) {
+            const int bit = detail::simd_last_bit(mask);
+            if (detail::simd_search_match(hay + i - 16 + bit, needle, m)) {
+                return first1 + (i - 16 + bit);
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+
+    while (i > 0) {
+        --i;
+        if (detail::simd_search_match(hay + i, needle, m)) {
+            return first1 + i;
+        }
+    }
+
+    return last1;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -0,0 +1,142 @@
+// nanorange/detail/algorithm/simd_set_intersection.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_SET_INTERSECTION_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_SET_INTERSECTION_HPP_INCLUDED
+
+#include <nanorange/detail/functional/comparisons.hpp>
+
+#include <climits>
+#include <type_traits>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::simd_set_intersection
+// (vectorised kernel for set_intersection)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether set_intersection of contiguous ranges of T, compared using Comp,
+// may use simd_set_intersection()
+template <typename T, typename Comp>
+constexpr bool simd_set_intersectable =
+#ifdef NANO_HAVE_SSE2
+    std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+    sizeof(T) == 4 && is_less<std::remove_const_t<Comp>, T>::value;
+#else
+    false;
+#endif
+
+// One step of the scalar set_intersection
+template <typename T1, typename T2, typename O>
+void simd_set_intersection_step(T1*& first1, T2*& first2, O& result)
+{
+    if (*first1 < *first2) {
+        ++first1;
+    } else {
+        if (!(*first2 < *first1)) {
+            *result = *first1;
+            ++result;
+            ++first1;
+        }
+        ++first2;
+    }
+}
+
+// Intersects the sorted ranges [first1, last1) and [first2, last2) four
+// elements at a time, in the manner of Schlegel, Willhalm and Lehner ("Fast
+// Sorted-Set Intersection using SIMD Instructions", ADMS 2011): comparing a
+// block from each range against all four rotations of the other finds every
+// element of the first block which also appears in the second. We then skip
+// each range past the elements which are not greater than the last one of
+// the other block, leaving both exactly where the scalar algorithm would
+// have got to. Stops when either range has fewer than four elements left,
+// advancing first1 and first2 to show where.
+//
+// This gives the same results as the scalar algorithm only if neither block
+// holds equal elements, as an element of the first block could then match
+// the same element of the second more than once (or vice versa). We check
+// for that, and take a scalar step instead when it happens.
+template <typename T1, typename T2, typename O>
+O simd_set_intersection(T1*& first1, T1* last1, T2*& first2, T2* last2,
+                        O result)
+{
+#ifdef NANO_HAVE_SSE2
+    using T = std::remove_const_t<T1>;
+
+    // SSE2 only has signed comparisons, so we flip the sign bit of unsigned
+    // values to preserve their order
+    const __m128i bias =
+        _mm_set1_epi32(std::is_signed<T>::value ? 0 : INT_MIN);
+
+    // The number of set bits in each four-bit mask
+    constexpr int popcount[16] = {0, 1, 1, 2, 1, 2, 2, 3,
+                                  1, 2, 2, 3, 2, 3, 3, 4};
+
+    while (last1 - first1 >= 4 && last2 - first2 >= 4) {
+        const __m128i a =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1));
+        const __m128i b =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2));
+
+        // Look for equal neighbours, comparing lanes 0-2 of each block with
+        // lanes 1-3
+        const __m128i dup = _mm_or_si128(
+            _mm_cmpeq_epi32(a, _mm_srli_si128(a, 4)),
+            _mm_cmpeq_epi32(b, _mm_srli_si128(b, 4)));
+        if ((_mm_movemask_ps(_mm_castsi128_ps(dup)) & 0x7) != 0) {
+            detail::simd_set_intersection_step(first1, first2, result);
+            continue;
+        }
+
+        __m128i eq = _mm_cmpeq_epi32(a, b);
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(
+            a, _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(
+            a, _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(
+            a, _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3))));
+        int matches = _mm_movemask_ps(_mm_castsi128_ps(eq));
+
+        const __m128i a_biased = _mm_xor_si128(a, bias);
+        const __m128i b_biased = _mm_xor_si128(b, bias);
+        const __m128i a_last =
+            _mm_shuffle_epi32(a_biased, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128i b_last =
+            _mm_shuffle_epi32(b_biased, _MM_SHUFFLE(3, 3, 3, 3));
+        const int a_skip = 4 - popcount[_mm_movemask_ps(
+            _mm_castsi128_ps(_mm_cmpgt_epi32(a_biased, b_last)))];
+        const int b_skip = 4 - popcount[_mm_movemask_ps(
+            _mm_castsi128_ps(_mm_cmpgt_epi32(b_biased, a_last)))];
+
+        for (int i = 0; matches != 0; ++i, matches >>= 1) {
+            if (matches & 1) {
+                *result = first1[i];
+                ++result;
+            }
+        }
+
+        first1 += a_skip;
+        first2 += b_skip;
+    }
+#else
+    (void) first1, (void) last1, (void) first2, (void) last2;
+#endif
+
+    return result;
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
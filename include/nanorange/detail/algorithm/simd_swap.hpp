@@ -0,0 +1,227 @@
+// nanorange/detail/algorithm/simd_swap.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_SIMD_SWAP_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_SIMD_SWAP_HPP_INCLUDED
+
+#include <nanorange/detail/swap.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::simd_swap_ranges, detail::simd_reverse and detail::block_rotate
+// (vectorised kernels for swap_ranges and reverse, and a memmove and block
+// swap kernel for rotate)
+//
+// Swapping elements whose type has no swap() of its own just exchanges their
+// object representations, so for contiguous ranges of trivially copyable
+// types we can move sixteen bytes at a time. reverse loads a vector from each
+// end and stores it at the other with its lanes reversed. rotate moves the
+// shorter side through a small buffer on the stack with memmove if it fits,
+// and otherwise swaps it with the matching block at the far end of the other
+// side (the Gries-Mills algorithm), which leaves a smaller rotation to do.
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Whether swapping two elements of T is the same as exchanging their object
+// representations, so that ranges of them can be permuted a block at a time
+template <typename T>
+constexpr bool bytewise_swappable =
+    !std::is_const<T>::value && !std::is_volatile<T>::value &&
+    !std::is_array<T>::value && std::is_trivially_copyable<T>::value &&
+    std::is_trivially_move_constructible<T>::value &&
+    std::is_trivially_move_assignable<T>::value && !swap_::has_adl_swap<T>;
+
+// Whether swap_ranges for contiguous ranges of T1 and T2 may use
+// simd_swap_ranges()
+template <typename T1, typename T2>
+constexpr bool simd_swappable_ranges =
+#ifdef NANO_HAVE_SSE2
+    std::is_same<T1, T2>::value && bytewise_swappable<T1>;
+#else
+    false;
+#endif
+
+// Whether reverse for a contiguous range of T may use simd_reverse()
+template <typename T>
+constexpr bool simd_reversible =
+#ifdef NANO_HAVE_SSE2
+    bytewise_swappable<T> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+#else
+    false;
+#endif
+
+// The size in bytes of the buffer through which block_rotate() moves the
+// shorter side of a rotation
+constexpr std::size_t rotate_buffer_size = 512;
+
+// Swaps the n elements starting at first1 with those starting at first2,
+// which must not overlap them, sixteen bytes at a time
+template <typename T>
+void simd_swap_ranges(T* first1, T* first2, std::ptrdiff_t n)
+{
+#ifdef NANO_HAVE_SSE2
+    auto bytes1 = reinterpret_cast<unsigned char*>(first1);
+    auto bytes2 = reinterpret_cast<unsigned char*>(first2);
+    std::size_t bytes = static_cast<std::size_t>(n) * sizeof(T);
+
+    for (; bytes >= 32; bytes -= 32, bytes1 += 32, bytes2 += 32) {
+        const auto p = reinterpret_cast<__m128i*>(bytes1);
+        const auto q = reinterpret_cast<__m128i*>(bytes2);
+        const __m128i a = _mm_loadu_si128(p);
+        const __m128i b = _mm_loadu_si128(p + 1);
+        const __m128i c = _mm_loadu_si128(q);
+        const __m128i d = _mm_loadu_si128(q + 1);
+        _mm_storeu_si128(p, c);
+        _mm_storeu_si128(p + 1, d);
+        _mm_storeu_si128(q, a);
+        _mm_storeu_si128(q + 1, b);
+    }
+
+    if (bytes >= 16) {
+        const auto p = reinterpret_cast<__m128i*>(bytes1);
+        const auto q = reinterpret_cast<__m128i*>(bytes2);
+        const __m128i a = _mm_loadu_si128(p);
+        _mm_storeu_si128(p, _mm_loadu_si128(q));
+        _mm_storeu_si128(q, a);
+        bytes -= 16;
+        bytes1 += 16;
+        bytes2 += 16;
+    }
+
+    for (std::size_t i = 0; i < bytes; ++i) {
+        const unsigned char tmp = bytes1[i];
+        bytes1[i] = bytes2[i];
+        bytes2[i] = tmp;
+    }
+#else
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        T tmp = first1[i];
+        first1[i] = first2[i];
+        first2[i] = tmp;
+    }
+#endif
+}
+
+#ifdef NANO_HAVE_SSE2
+
+// Reverses the order of the N-byte elements of v. SSE2 cannot shuffle bytes,
+// so we reverse the 32-bit lanes, then the 16-bit halves of each, and then
+// the bytes of those.
+template <std::size_t N>
+__m128i simd_reverse_lanes(__m128i v)
+{
+    if (N == 8) {
+        return _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    }
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    if (N == 4) {
+        return v;
+    }
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    if (N == 2) {
+        return v;
+    }
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+#endif // NANO_HAVE_SSE2
+
+// Reverses [first, last), exchanging sixteen bytes from each end at a time
+template <typename T>
+void simd_reverse(T* first, T* last)
+{
+#ifdef NANO_HAVE_SSE2
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+
+    while (last - first >= 2 * lanes) {
+        last -= lanes;
+        const auto p = reinterpret_cast<__m128i*>(first);
+        const auto q = reinterpret_cast<__m128i*>(last);
+        const __m128i a = _mm_loadu_si128(p);
+        const __m128i b = _mm_loadu_si128(q);
+        _mm_storeu_si128(p, detail::simd_reverse_lanes<sizeof(T)>(b));
+        _mm_storeu_si128(q, detail::simd_reverse_lanes<sizeof(T)>(a));
+        first += lanes;
+    }
+#endif
+
+    while (first != last && first != --last) {
+        T tmp = *first;
+        *first = *last;
+        *last = tmp;
+        ++first;
+    }
+}
+
+// Rotates [first, last) so that middle becomes the first element, and
+// returns the new position of first. Once the shorter side fits into the
+// buffer we move it out of the way and memmove the longer side past it;
+// until then, we swap it into its final place with the matching block of
+// the longer side.
+template <typename T>
+T* block_rotate(T* first, T* middle, T* last)
+{
+    constexpr std::ptrdiff_t buffer_len = rotate_buffer_size / sizeof(T);
+    unsigned char buffer[rotate_buffer_size];
+    T* const ret = first + (last - middle);
+
+    while (true) {
+        const std::ptrdiff_t len1 = middle - first;
+        const std::ptrdiff_t len2 = last - middle;
+        const std::size_t bytes1 = static_cast<std::size_t>(len1) * sizeof(T);
+        const std::size_t bytes2 = static_cast<std::size_t>(len2) * sizeof(T);
+
+        if (len2 <= len1 && len2 <= buffer_len) {
+            if (len2 > 0) {
+                std::memcpy(buffer, middle, bytes2);
+                std::memmove(first + len2, first, bytes1);
+                std::memcpy(first, buffer, bytes2);
+            }
+            return ret;
+        }
+
+        if (len1 <= buffer_len) {
+            if (len1 > 0) {
+                std::memcpy(buffer, first, bytes1);
+                std::memmove(first, middle, bytes2);
+                std::memcpy(last - len1, buffer, bytes1);
+            }
+            return ret;
+        }
+
+        if (len1 <= len2) {
+            // The start of the second side is now in place at the front,
+            // and the first side must be rotated with the rest of it
+            detail::simd_swap_ranges(first, middle, len1);
+            first = middle;
+            middle += len1;
+        } else {
+            // The end of the first side is now in place at the back, and
+            // the rest of it must be rotated with the second side
+            detail::simd_swap_ranges(middle - len2, middle, len2);
+            last = middle;
+            middle -= len2;
+        }
+    }
+}
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
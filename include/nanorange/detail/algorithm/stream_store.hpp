@@ -0,0 +1,177 @@
+// nanorange/detail/algorithm/stream_store.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_ALGORITHM_STREAM_STORE_HPP_INCLUDED
+#define NANORANGE_DETAIL_ALGORITHM_STREAM_STORE_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#ifdef NANO_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+// The size in bytes above which fill and uninitialized_fill (and copy, unless
+// memmove already does so) write contiguous ranges with non-temporal stores,
+// which bypass the cache rather than evicting everything else from it. This
+// should be well above the size of the last-level cache; the default is
+// 32 MiB.
+#ifndef NANORANGE_STREAM_STORE_THRESHOLD
+#define NANORANGE_STREAM_STORE_THRESHOLD (std::size_t{32} << 20)
+#endif
+
+// glibc's memcpy and memmove already switch to non-temporal stores for copies
+// larger than the last-level cache, and are faster at it than stream_copy()
+#if defined(NANO_HAVE_SSE2) && !defined(__GLIBC__)
+#define NANO_HAVE_STREAM_COPY
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// detail::stream_copy and detail::stream_fill
+// (non-temporal store kernels for copying and filling large buffers)
+//
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+constexpr std::size_t stream_store_threshold = NANORANGE_STREAM_STORE_THRESHOLD;
+
+// Whether filling bytes bytes should use non-temporal stores
+inline bool use_stream_fill(std::size_t bytes) noexcept
+{
+#ifdef NANO_HAVE_SSE2
+    return bytes >= stream_store_threshold;
+#else
+    (void) bytes;
+    return false;
+#endif
+}
+
+// Whether copying bytes bytes should use stream_copy() rather than memmove
+inline bool use_stream_copy(std::size_t bytes) noexcept
+{
+#ifdef NANO_HAVE_STREAM_COPY
+    return bytes >= stream_store_threshold;
+#else
+    (void) bytes;
+    return false;
+#endif
+}
+
+// Whether a contiguous range of T can be filled by repeating the object
+// representation of a single element of it sixteen bytes at a time
+template <typename T>
+constexpr bool stream_fillable =
+    !std::is_const<T>::value && !std::is_volatile<T>::value &&
+    std::is_trivially_copyable<T>::value && 16 % sizeof(T) == 0;
+
+#ifdef NANO_HAVE_SSE2
+
+// Copies bytes bytes from src to dst, which must not overlap, aligning the
+// stores and writing them past the cache. Finishes with a fence, so that the
+// data is visible to other threads in the usual way afterwards.
+inline void stream_copy(void* dst, const void* src, std::size_t bytes)
+{
+    auto out = static_cast<unsigned char*>(dst);
+    auto in = static_cast<const unsigned char*>(src);
+
+    std::size_t head = (16 - reinterpret_cast<std::uintptr_t>(out) % 16) % 16;
+    head = head < bytes ? head : bytes;
+    std::memcpy(out, in, head);
+    out += head;
+    in += head;
+    bytes -= head;
+
+    for (; bytes >= 64; bytes -= 64, in += 64, out += 64) {
+        const auto src_block = reinterpret_cast<const __m128i*>(in);
+        const auto dst_block = reinterpret_cast<__m128i*>(out);
+        const __m128i a = _mm_loadu_si128(src_block);
+        const __m128i b = _mm_loadu_si128(src_block + 1);
+        const __m128i c = _mm_loadu_si128(src_block + 2);
+        const __m128i d = _mm_loadu_si128(src_block + 3);
+        _mm_stream_si128(dst_block, a);
+        _mm_stream_si128(dst_block + 1, b);
+        _mm_stream_si128(dst_block + 2, c);
+        _mm_stream_si128(dst_block + 3, d);
+    }
+
+    for (; bytes >= 16; bytes -= 16, in += 16, out += 16) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+    }
+
+    std::memcpy(out, in, bytes);
+    _mm_sfence();
+}
+
+// Fills the n elements starting at first with copies of the object
+// representation of elem, in the same way as stream_copy()
+template <typename T>
+void stream_fill(T* first, std::ptrdiff_t n, const T& elem)
+{
+    // Two vectors' worth of repeated elements, so that we can start the
+    // aligned stores from any byte of an element
+    unsigned char pattern[32];
+    for (std::size_t k = 0; k < 32; k += sizeof(T)) {
+        std::memcpy(pattern + k, std::addressof(elem), sizeof(T));
+    }
+
+    auto out = reinterpret_cast<unsigned char*>(first);
+    std::size_t bytes = static_cast<std::size_t>(n) * sizeof(T);
+
+    std::size_t head = (16 - reinterpret_cast<std::uintptr_t>(out) % 16) % 16;
+    head = head < bytes ? head : bytes;
+    std::memcpy(out, pattern, head);
+    out += head;
+    bytes -= head;
+
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern + head));
+
+    for (; bytes >= 64; bytes -= 64, out += 64) {
+        const auto dst_block = reinterpret_cast<__m128i*>(out);
+        _mm_stream_si128(dst_block, block);
+        _mm_stream_si128(dst_block + 1, block);
+        _mm_stream_si128(dst_block + 2, block);
+        _mm_stream_si128(dst_block + 3, block);
+    }
+
+    for (; bytes >= 16; bytes -= 16, out += 16) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), block);
+    }
+
+    std::memcpy(out, pattern + head, bytes);
+    _mm_sfence();
+}
+
+#else
+
+inline void stream_copy(void* dst, const void* src, std::size_t bytes)
+{
+    std::memcpy(dst, src, bytes);
+}
+
+template <typename T>
+void stream_fill(T* first, std::ptrdiff_t n, const T& elem)
+{
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        std::memcpy(first + i, std::addressof(elem), sizeof(T));
+    }
+}
+
+#endif // NANO_HAVE_SSE2
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
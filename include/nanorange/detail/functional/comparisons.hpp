@@ -199,6 +199,63 @@ template <typename T = void>
 struct less_equal : detail::less_equal_helper<T> {
 };
 
+namespace detail {
+
+// Whether Pred is equal_to<> or equal_to<T> (or the std:: equivalents), so
+// that it compares values of the built-in type T using the built-in ==
+template <typename Pred, typename T>
+struct is_equal_to : std::false_type {};
+
+template <typename T>
+struct is_equal_to<equal_to<>, T> : std::true_type {};
+template <typename T>
+struct is_equal_to<equal_to<T>, T> : std::true_type {};
+template <typename T>
+struct is_equal_to<std::equal_to<>, T> : std::true_type {};
+template <typename T>
+struct is_equal_to<std::equal_to<T>, T> : std::true_type {};
+
+// Likewise for less and the built-in < operator
+template <typename Comp, typename T>
+struct is_less : std::false_type {};
+
+template <typename T>
+struct is_less<less<>, T> : std::true_type {};
+template <typename T>
+struct is_less<less<T>, T> : std::true_type {};
+template <typename T>
+struct is_less<std::less<>, T> : std::true_type {};
+template <typename T>
+struct is_less<std::less<T>, T> : std::true_type {};
+
+// And for greater and the built-in > operator
+template <typename Comp, typename T>
+struct is_greater : std::false_type {};
+
+template <typename T>
+struct is_greater<greater<>, T> : std::true_type {};
+template <typename T>
+struct is_greater<greater<T>, T> : std::true_type {};
+template <typename T>
+struct is_greater<std::greater<>, T> : std::true_type {};
+template <typename T>
+struct is_greater<std::greater<T>, T> : std::true_type {};
+
+// A unary predicate which compares its argument with val using equal_to<>,
+// for the algorithms which look for a value rather than a predicate
+template <typename ValueType>
+struct equal_to_pred {
+    const ValueType& val;
+
+    template <typename T>
+    constexpr bool operator()(const T& t) const
+    {
+        return equal_to<>{}(t, val);
+    }
+};
+
+} // namespace detail
+
 NANO_END_NAMESPACE
 
 #endif
\ No newline at end of file
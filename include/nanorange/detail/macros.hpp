@@ -33,6 +33,33 @@
 #define NANO_HAVE_DEDUCTION_GUIDES
 #endif
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define NANO_HAVE_IS_CONSTANT_EVALUATED
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define NANO_HAVE_IS_CONSTANT_EVALUATED
+#endif
+
+// Hints that the memory at addr is about to be read
+#if defined(__GNUC__) || defined(__clang__)
+#define NANO_PREFETCH(addr) __builtin_prefetch(addr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define NANO_PREFETCH(addr)                                                    \
+    _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define NANO_PREFETCH(addr) ((void) (addr))
+#endif
+
+// Whether the vectorised kernels of some algorithms may use SSE2, which every
+// x86-64 processor supports. Define NANORANGE_NO_SIMD to disable them.
+#if !defined(NANORANGE_NO_SIMD) &&                                             \
+    (defined(__SSE2__) || defined(_M_X64) ||                                   \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NANO_HAVE_SSE2
+#endif
+
 #define NANO_CONCEPT constexpr bool
 
 #define NANO_BEGIN_NAMESPACE                                                   \
@@ -53,6 +80,12 @@ inline namespace ranges                                                        \
     inline constexpr type name{};                                              \
     }
 
+#define NANO_INLINE_VAR_TEMPLATE(tparam, type, name)                           \
+    inline namespace function_objects {                                        \
+    template <tparam>                                                          \
+    inline constexpr type name{};                                              \
+    }
+
 #else
 #define NANO_INLINE_VAR(type, name)                                            \
     inline namespace function_objects {                                        \
@@ -61,6 +94,15 @@ inline namespace ranges                                                        \
         ::nano::ranges::detail::static_const_<type>::value;                    \
     }                                                                          \
     }
+
+#define NANO_INLINE_VAR_TEMPLATE(tparam, type, name)                           \
+    inline namespace function_objects {                                        \
+    inline namespace {                                                         \
+    template <tparam>                                                          \
+    constexpr const auto& name =                                               \
+        ::nano::ranges::detail::static_const_<type>::value;                    \
+    }                                                                          \
+    }
 #endif
 
 NANO_BEGIN_NAMESPACE
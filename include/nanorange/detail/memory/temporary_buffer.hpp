@@ -0,0 +1,139 @@
+// nanorange/detail/memory/temporary_buffer.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_DETAIL_MEMORY_TEMPORARY_BUFFER_HPP_INCLUDED
+#define NANORANGE_DETAIL_MEMORY_TEMPORARY_BUFFER_HPP_INCLUDED
+
+#include <nanorange/ranges.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+NANO_BEGIN_NAMESPACE
+
+namespace detail {
+
+// Scratch space for the algorithms which can make use of extra memory, such
+// as radix sort and the merge-based algorithms. Like the (deprecated)
+// std::get_temporary_buffer(), this tries to allocate space for the requested
+// number of objects, and asks for less if that fails: users must check size()
+// and be prepared to work with a smaller (possibly empty) buffer.
+//
+// Unlike get_temporary_buffer(), the objects in the buffer are constructed.
+// Rather than requiring T to be DefaultConstructible, we do this by moving a
+// "seed" value along the buffer and then back into its original position, in
+// the same manner as libstdc++. The buffer therefore contains valid but
+// unspecified (moved-from) values. Trivial types are left uninitialised.
+template <typename T>
+class temporary_buffer {
+public:
+    temporary_buffer() = default;
+
+    template <typename I>
+    temporary_buffer(std::ptrdiff_t len, I seed)
+    {
+        // We don't try to deal with over-aligned types before C++17
+        if (alignof(T) > alignof(std::max_align_t)) {
+            return;
+        }
+
+        constexpr std::ptrdiff_t max_len =
+            (std::numeric_limits<std::ptrdiff_t>::max)() /
+            static_cast<std::ptrdiff_t>(sizeof(T));
+        len = len < max_len ? len : max_len;
+
+        while (len > 0) {
+            void* p = ::operator new(static_cast<std::size_t>(len) * sizeof(T),
+                                     std::nothrow);
+            if (p) {
+                data_ = static_cast<T*>(p);
+                break;
+            }
+            len /= 2;
+        }
+
+        if (!data_) {
+            return;
+        }
+
+        construct(len, seed, std::is_trivial<T>{});
+        size_ = len;
+    }
+
+    temporary_buffer(const temporary_buffer&) = delete;
+    temporary_buffer& operator=(const temporary_buffer&) = delete;
+
+    ~temporary_buffer() { release(size_); }
+
+    T* begin() const noexcept { return data_; }
+    T* end() const noexcept { return data_ + size_; }
+    std::ptrdiff_t size() const noexcept { return size_; }
+
+private:
+    // Trivial types need no construction (and their values are unspecified
+    // anyway), which saves a pass over the memory
+    template <typename I>
+    void construct(std::ptrdiff_t, I&, std::true_type) noexcept {}
+
+    template <typename I>
+    void construct(std::ptrdiff_t len, I& seed, std::false_type)
+    {
+        std::ptrdiff_t i = 0;
+        try {
+            ::new (static_cast<void*>(data_)) T(nano::iter_move(seed));
+            for (i = 1; i < len; ++i) {
+                ::new (static_cast<void*>(data_ + i)) T(std::move(data_[i - 1]));
+            }
+            *seed = std::move(data_[len - 1]);
+        } catch (...) {
+            if (i > 0) {
+                *seed = std::move(data_[i - 1]);
+            }
+            release(i);
+            throw;
+        }
+    }
+
+    void release(std::ptrdiff_t n) noexcept
+    {
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            data_[i].~T();
+        }
+        ::operator delete(data_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    T* data_ = nullptr;
+    std::ptrdiff_t size_ = 0;
+};
+
+// The algorithms which can use a temporary_buffer have (extension) overloads
+// taking a RandomAccessRange of the iterator's value type to use instead, so
+// that repeated calls need not allocate. The contents of the buffer are left
+// in a valid but unspecified state.
+template <typename, typename>
+auto ScratchBuffer_fn(long) -> std::false_type;
+
+template <typename I, typename Buf>
+auto ScratchBuffer_fn(int) -> std::enable_if_t<
+    RandomAccessRange<Buf> &&
+    Same<iter_value_t<iterator_t<Buf>>, iter_value_t<I>> &&
+    IndirectlyMovable<I, iterator_t<Buf>> &&
+    IndirectlyMovable<iterator_t<Buf>, I>,
+    std::true_type>;
+
+template <typename I, typename Buf>
+NANO_CONCEPT ScratchBuffer = decltype(ScratchBuffer_fn<I, Buf>(0))::value;
+
+} // namespace detail
+
+NANO_END_NAMESPACE
+
+#endif
@@ -22,6 +22,15 @@ void swap(T&, T&) = delete;
 template <typename T, std::size_t N>
 void swap(T (&)[N], T (&)[N]) = delete;
 
+// Whether swapping two lvalues of T finds a swap() by argument-dependent
+// lookup, rather than moving them through a temporary
+template <typename T, typename = void>
+constexpr bool has_adl_swap = false;
+
+template <typename T>
+constexpr bool has_adl_swap<
+    T, void_t<decltype(swap(std::declval<T&>(), std::declval<T&>()))>> = true;
+
 struct fn {
 private:
     template <typename T, typename U>
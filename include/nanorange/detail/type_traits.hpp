@@ -75,6 +75,18 @@ template <>
 struct priority_tag<0> {
 };
 
+// Returns true when called during constant evaluation. If the compiler cannot
+// tell us, we conservatively assume that we are in a constant expression, so
+// that non-constexpr fast paths are never taken.
+constexpr bool is_constant_evaluated() noexcept
+{
+#ifdef NANO_HAVE_IS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
 } // namespace detail
 
 NANO_END_NAMESPACE
@@ -0,0 +1,50 @@
+// nanorange/execution.hpp
+//
+// Copyright (c) 2018 Tristan Brindle (tcbrindle at gmail dot com)
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NANORANGE_EXECUTION_HPP_INCLUDED
+#define NANORANGE_EXECUTION_HPP_INCLUDED
+
+#include <nanorange/detail/macros.hpp>
+
+#include <type_traits>
+
+NANO_BEGIN_NAMESPACE
+
+// [execpol]
+// Extension: C++14-compatible versions of the C++17 execution policies, for
+// use with the Nanorange algorithms which provide parallel overloads
+
+namespace execution {
+
+struct sequenced_policy {};
+struct parallel_policy {};
+struct parallel_unsequenced_policy {};
+
+NANO_INLINE_VAR(sequenced_policy, seq)
+NANO_INLINE_VAR(parallel_policy, par)
+NANO_INLINE_VAR(parallel_unsequenced_policy, par_unseq)
+
+} // namespace execution
+
+template <typename T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<execution::sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_unsequenced_policy>
+    : std::true_type {};
+
+template <typename T>
+constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+NANO_END_NAMESPACE
+
+#endif
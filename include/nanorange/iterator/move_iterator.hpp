@@ -7,7 +7,9 @@
 #ifndef NANORANGE_ITERATOR_MOVE_ITERATOR_HPP_INCLUDED
 #define NANORANGE_ITERATOR_MOVE_ITERATOR_HPP_INCLUDED
 
+#include <nanorange/detail/iterator/algorithm_requirements.hpp>
 #include <nanorange/detail/iterator/concepts.hpp>
+#include <nanorange/detail/iterator/iter_swap.hpp>
 #include <nanorange/iterator/default_sentinel.hpp>
 
 NANO_BEGIN_NAMESPACE
@@ -7,18 +7,29 @@
 #ifndef NANORANGE_MEMORY_UNINITIALIZED_FILL_HPP_INCLUDED
 #define NANORANGE_MEMORY_UNINITIALIZED_FILL_HPP_INCLUDED
 
+#include <nanorange/detail/algorithm/stream_store.hpp>
+#include <nanorange/iterator/operations.hpp>
 #include <nanorange/memory/destroy.hpp>
 
 NANO_BEGIN_NAMESPACE
 
 namespace detail {
 
+// Whether constructing elements of T from a value of type U can be done by
+// constructing a single element and copying its object representation
+template <typename T, typename U>
+constexpr bool stream_constructible =
+    stream_fillable<T> &&
+    ((std::is_scalar<T>::value && std::is_scalar<U>::value) ||
+     (std::is_same<T, U>::value &&
+      std::is_trivially_copy_constructible<T>::value));
+
 struct uninitialized_fill_fn {
 private:
     friend struct uninitialized_fill_n_fn;
 
     template <typename I, typename S, typename T>
-    static I impl(I first, S last, const T& x)
+    static I impl(I first, S last, const T& x, priority_tag<0>)
     {
         I it = first;
         try {
@@ -34,6 +45,41 @@ private:
         }
     }
 
+    // Large contiguous ranges of trivially copyable types can be filled using
+    // non-temporal stores
+    template <typename E, typename T>
+    static auto impl(E* first, E* last, const T& x, priority_tag<1>)
+        -> std::enable_if_t<stream_constructible<E, T>, E*>
+    {
+        const std::ptrdiff_t n = last - first;
+        if (n > 0 && detail::use_stream_fill(static_cast<std::size_t>(n) *
+                                             sizeof(E))) {
+            const E elem(x);
+            detail::stream_fill(first, n, elem);
+            return last;
+        }
+
+        return uninitialized_fill_fn::impl(first, last, x, priority_tag<0>{});
+    }
+
+    template <typename Rng, typename T>
+    static auto range_impl(Rng& rng, const T& x, priority_tag<1>)
+        -> std::enable_if_t<ContiguousRange<Rng> && SizedRange<Rng>,
+                            iterator_t<Rng>>
+    {
+        const auto ptr = nano::data(rng);
+        const auto n = nano::distance(rng);
+        uninitialized_fill_fn::impl(ptr, ptr + n, x, priority_tag<1>{});
+        return nano::begin(rng) + n;
+    }
+
+    template <typename Rng, typename T>
+    static iterator_t<Rng> range_impl(Rng& rng, const T& x, priority_tag<0>)
+    {
+        return uninitialized_fill_fn::impl(nano::begin(rng), nano::end(rng), x,
+                                           priority_tag<1>{});
+    }
+
 public:
     template <typename I, typename S, typename T>
     std::enable_if_t<
@@ -43,7 +89,8 @@ public:
         I>
     operator()(I first, S last, const T& x) const
     {
-        return uninitialized_fill_fn::impl(std::move(first), std::move(last), x);
+        return uninitialized_fill_fn::impl(std::move(first), std::move(last), x,
+                                           priority_tag<1>{});
     }
 
     template <typename Rng, typename T>
@@ -53,7 +100,7 @@ public:
         safe_iterator_t<Rng>>
     operator()(Rng&& rng, const T& x) const
     {
-        return uninitialized_fill_fn::impl(nano::begin(rng), nano::end(rng), x);
+        return uninitialized_fill_fn::range_impl(rng, x, priority_tag<1>{});
     }
 };
 
@@ -64,6 +111,24 @@ NANO_INLINE_VAR(detail::uninitialized_fill_fn, uninitialized_fill)
 namespace detail {
 
 struct uninitialized_fill_n_fn {
+private:
+    template <typename I, typename T>
+    static I impl(I first, iter_difference_t<I> n, const T& x, priority_tag<0>)
+    {
+        return uninitialized_fill_fn::impl(
+                    make_counted_iterator(std::move(first), n),
+                    default_sentinel{}, x, priority_tag<0>{}).base();
+    }
+
+    template <typename E, typename T>
+    static auto impl(E* first, std::ptrdiff_t n, const T& x, priority_tag<1>)
+        -> std::enable_if_t<stream_constructible<E, T>, E*>
+    {
+        return uninitialized_fill_fn::impl(first, first + (n > 0 ? n : 0), x,
+                                           priority_tag<1>{});
+    }
+
+public:
     template <typename I, typename T>
     std::enable_if_t<
         NoThrowForwardIterator<I> &&
@@ -71,9 +136,8 @@ struct uninitialized_fill_n_fn {
         I>
     operator()(I first, iter_difference_t<I> n, const T& x) const
     {
-        return uninitialized_fill_fn::impl(
-                    make_counted_iterator(std::move(first), n),
-                    default_sentinel{}, x).base();
+        return uninitialized_fill_n_fn::impl(std::move(first), n, x,
+                                             priority_tag<1>{});
     }
 };
 
@@ -18,18 +18,21 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include <stl2/detail/algorithm/inplace_merge.hpp>
+#include <nanorange/algorithm/inplace_merge.hpp>
 #include <cassert>
 #include <algorithm>
 #include <random>
-#include "../simple_test.hpp"
+#include <vector>
+#include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
-namespace stl2 = __stl2;
+namespace stl2 = nano;
 
 namespace { std::mt19937 gen; }
 
+namespace {
+
 template <class Iter, typename Sent = Iter>
 void
 test_one_iter(unsigned N, unsigned M)
@@ -63,7 +66,7 @@ test_one_rng(unsigned N, unsigned M)
 	std::shuffle(ia, ia+N, gen);
 	std::sort(ia, ia+M);
 	std::sort(ia+M, ia+N);
-	auto res = stl2::inplace_merge(::as_lvalue(stl2::ext::make_range(Iter(ia), Sent(ia+N))), Iter(ia+M));
+	auto res = stl2::inplace_merge(::as_lvalue(stl2::make_subrange(Iter(ia), Sent(ia+N))), Iter(ia+M));
 	CHECK(res == Iter(ia+N));
 	if(N > 0)
 	{
@@ -75,8 +78,8 @@ test_one_rng(unsigned N, unsigned M)
 	std::shuffle(ia, ia+N, gen);
 	std::sort(ia, ia+M);
 	std::sort(ia+M, ia+N);
-	auto res2 = stl2::inplace_merge(stl2::ext::make_range(Iter(ia), Sent(ia+N)), Iter(ia+M));
-	CHECK(res2.get_unsafe() == Iter(ia+N));
+	auto res2 = stl2::inplace_merge(stl2::make_subrange(Iter(ia), Sent(ia+N)), Iter(ia+M));
+	CHECK(res2 == Iter(ia+N));
 	if(N > 0)
 	{
 		CHECK(ia[0] == 0);
@@ -127,12 +130,66 @@ test()
 	test<Iter>(1000);
 }
 
-int main()
+template <class Iter>
+void
+test_one_buffer(unsigned N, unsigned M, unsigned B)
+{
+	std::vector<int> v(N);
+	for (unsigned i = 0; i < N; ++i)
+		v[i] = i % 7;
+	std::shuffle(v.begin(), v.end(), gen);
+	std::sort(v.begin(), v.begin() + M);
+	std::sort(v.begin() + M, v.end());
+	std::vector<int> w = v;
+	std::inplace_merge(w.begin(), w.begin() + M, w.end());
+	std::vector<int> buf(B);
+	auto res = stl2::inplace_merge(Iter(v.data()), Iter(v.data() + M),
+	                               Iter(v.data() + N), buf);
+	CHECK(res == Iter(v.data() + N));
+	CHECK(v == w);
+}
+
+struct S
+{
+	int i, j;
+};
+
+}
+
+TEST_CASE("alg.inplace_merge")
 {
 	// test<forward_iterator<int*> >();
 	test<bidirectional_iterator<int*> >();
 	test<random_access_iterator<int*> >();
 	test<int*>();
 
-	return ::test_result();
+	// Caller-supplied buffers of various sizes
+	for (unsigned B : {0, 1, 10, 250, 750, 1000})
+	{
+		test_one_buffer<bidirectional_iterator<int*>>(1000, 250, B);
+		test_one_buffer<int*>(1000, 250, B);
+		test_one_buffer<int*>(1000, 750, B);
+	}
+
+	// Projections and stability
+	{
+		std::vector<S> v(1000);
+		for (int i = 0; (std::size_t)i < v.size(); ++i)
+		{
+			v[i].i = i % 10;
+			v[i].j = i;
+		}
+		auto mid = v.begin() + 300;
+		std::stable_sort(v.begin(), mid, [](S a, S b) { return a.i < b.i; });
+		std::stable_sort(mid, v.end(), [](S a, S b) { return a.i < b.i; });
+		std::vector<S> w = v;
+		std::inplace_merge(w.begin(), w.begin() + 300, w.end(),
+		                   [](S a, S b) { return a.i < b.i; });
+		CHECK(stl2::inplace_merge(v, mid, std::less<int>{}, &S::i) == v.end());
+		for (std::size_t i = 0; i < v.size(); ++i)
+		{
+			CHECK(v[i].i == w[i].i);
+			CHECK(v[i].j == w[i].j);
+		}
+	}
 }
@@ -14,6 +14,8 @@
 //  or a copy at http://stlab.adobe.com/licenses.html)
 
 #include <nanorange/algorithm/lower_bound.hpp>
+#include <algorithm>
+#include <deque>
 #include <vector>
 #include <utility>
 #include "../catch.hpp"
@@ -38,6 +40,17 @@ void not_totally_ordered()
 	stl2::lower_bound(vec, my_int{10}, compare);
 }
 
+// Checks every lower bound in [first, first + n) (which holds each of
+// 0, 2, 4... twice) against std::lower_bound
+template <typename I>
+void test_exhaustive(I first, int n)
+{
+	for (int v = -1; v <= n + 1; ++v) {
+		CHECK(stl2::lower_bound(first, first + n, v) ==
+		      std::lower_bound(first, first + n, v));
+	}
+}
+
 }
 
 TEST_CASE("alg.lower_bound")
@@ -78,3 +91,19 @@ TEST_CASE("alg.lower_bound")
 	CHECK(*stl2::lower_bound(stl2::ext::iota_view<int>{}, 42).get_unsafe() == 42);
 #endif
 }
+
+TEST_CASE("alg.lower_bound (random access)")
+{
+	// Sizes around the powers of two, and large enough to prefetch
+	for (int n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 255, 256, 257, 1000, 5000}) {
+		std::vector<int> v(n);
+		for (int i = 0; i < n; ++i) {
+			v[i] = i / 2 * 2;
+		}
+		std::deque<int> d(v.begin(), v.end());
+
+		test_exhaustive(v.data(), n);
+		test_exhaustive(v.begin(), n);
+		test_exhaustive(d.begin(), n);
+	}
+}
@@ -18,19 +18,22 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include <stl2/detail/algorithm/nth_element.hpp>
+#include <nanorange/algorithm/nth_element.hpp>
 #include <cassert>
 #include <memory>
 #include <random>
+#include <vector>
 #include <algorithm>
-#include "../simple_test.hpp"
+#include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
-namespace stl2 = __stl2;
+namespace stl2 = nano;
 
 namespace { std::mt19937 gen; }
 
+namespace {
+
 void
 test_one(unsigned N, unsigned M)
 {
@@ -43,10 +46,10 @@ test_one(unsigned N, unsigned M)
 	CHECK(stl2::nth_element(array.get(), array.get()+M, array.get()+N) == array.get()+N);
 	CHECK((unsigned)array[M] == M);
 	std::shuffle(array.get(), array.get()+N, gen);
-	CHECK(stl2::nth_element(::as_lvalue(stl2::ext::make_range(array.get(), array.get()+N)), array.get()+M) == array.get()+N);
+	CHECK(stl2::nth_element(::as_lvalue(stl2::make_subrange(array.get(), array.get()+N)), array.get()+M) == array.get()+N);
 	CHECK((unsigned)array[M] == M);
 	std::shuffle(array.get(), array.get()+N, gen);
-	CHECK(stl2::nth_element(stl2::ext::make_range(array.get(), array.get()+N), array.get()+M).get_unsafe() == array.get()+N);
+	CHECK(stl2::nth_element(stl2::make_subrange(array.get(), array.get()+N), array.get()+M) == array.get()+N);
 	CHECK((unsigned)array[M] == M);
 	stl2::nth_element(array.get(), array.get()+N, array.get()+N); // begin, end, end
 }
@@ -71,7 +74,25 @@ struct S
 	int i,j;
 };
 
-int main()
+// Checks the nth_element postconditions against a sorted copy
+void
+test_many_equal(unsigned N, unsigned K, unsigned M)
+{
+	std::vector<int> v(N);
+	for (unsigned i = 0; i < N; ++i)
+		v[i] = static_cast<int>(i % K);
+	std::shuffle(v.begin(), v.end(), gen);
+	std::vector<int> sorted = v;
+	std::sort(sorted.begin(), sorted.end());
+	CHECK(stl2::nth_element(v, v.begin() + M) == v.end());
+	CHECK(v[M] == sorted[M]);
+	CHECK(std::all_of(v.begin(), v.begin() + M, [&](int i) { return i <= v[M]; }));
+	CHECK(std::all_of(v.begin() + M, v.end(), [&](int i) { return i >= v[M]; }));
+}
+
+}
+
+TEST_CASE("alg.nth_element")
 {
 	int d = 0;
 	stl2::nth_element(&d, &d, &d);
@@ -95,5 +116,21 @@ int main()
 	CHECK(ia[M].i == M);
 	CHECK(ia[M].j == M);
 
-	return test_result();
+	// Large enough to use Floyd-Rivest sampling
+	test(100000);
+	test_many_equal(100000, 1, 500);
+	test_many_equal(100000, 3, 50000);
+	test_many_equal(100000, 100, 99000);
+	test_many_equal(100000, 50000, 12345);
+
+	// Patterns which defeat median-of-3 pivot selection
+	{
+		std::vector<int> v(100000);
+		for (int i = 0; (std::size_t)i < v.size(); ++i)
+			v[i] = i % 2 == 0 ? i : (int)v.size() - i;
+		std::vector<int> sorted = v;
+		std::sort(sorted.begin(), sorted.end());
+		stl2::nth_element(v, v.begin() + 77777, std::less<int>{});
+		CHECK(v[77777] == sorted[77777]);
+	}
 }
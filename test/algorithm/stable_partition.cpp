@@ -22,14 +22,19 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include <stl2/detail/algorithm/stable_partition.hpp>
+#include <nanorange/algorithm/stable_partition.hpp>
+#include <algorithm>
 #include <memory>
+#include <random>
 #include <utility>
-#include "../simple_test.hpp"
+#include <vector>
+#include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
-namespace ranges = __stl2;
+namespace ranges = nano;
+
+namespace {
 
 struct is_odd
 {
@@ -201,7 +206,7 @@ test_range()
 	{  // check mixed
 		P ap[] = { {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 1}, {2, 2}, {3, 1}, {3, 2}, {4, 1}, {4, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + 4);
 		CHECK(ap[0] == P{1, 1});
 		CHECK(ap[1] == P{1, 2});
@@ -217,7 +222,7 @@ test_range()
 	{
 		P ap[] = { {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 1}, {2, 2}, {3, 1}, {3, 2}, {4, 1}, {4, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + 4);
 		CHECK(ap[0] == P{1, 1});
 		CHECK(ap[1] == P{1, 2});
@@ -230,21 +235,21 @@ test_range()
 		CHECK(ap[8] == P{4, 1});
 		CHECK(ap[9] == P{4, 2});
 		// check empty
-		r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap))), odd_first());
+		r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap))), odd_first());
 		CHECK(base(r) == ap);
 		// check one true
-		r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+1))), odd_first());
+		r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+1))), odd_first());
 		CHECK(base(r) == ap+1);
 		CHECK(ap[0] == P{1, 1});
 		// check one false
-		r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap+4), Sent(ap+5))), odd_first());
+		r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap+4), Sent(ap+5))), odd_first());
 		CHECK(base(r) == ap+4);
 		CHECK(ap[4] == P{0, 1});
 	}
 	{  // check all false
 		P ap[] = { {0, 1}, {0, 2}, {2, 1}, {2, 2}, {4, 1}, {4, 2}, {6, 1}, {6, 2}, {8, 1}, {8, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap);
 		CHECK(ap[0] == P{0, 1});
 		CHECK(ap[1] == P{0, 2});
@@ -260,7 +265,7 @@ test_range()
 	{  // check all true
 		P ap[] = { {1, 1}, {1, 2}, {3, 1}, {3, 2}, {5, 1}, {5, 2}, {7, 1}, {7, 2}, {9, 1}, {9, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + size);
 		CHECK(ap[0] == P{1, 1});
 		CHECK(ap[1] == P{1, 2});
@@ -276,7 +281,7 @@ test_range()
 	{  // check all false but first true
 		P ap[] = { {1, 1}, {0, 2}, {2, 1}, {2, 2}, {4, 1}, {4, 2}, {6, 1}, {6, 2}, {8, 1}, {8, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + 1);
 		CHECK(ap[0] == P{1, 1});
 		CHECK(ap[1] == P{0, 2});
@@ -292,7 +297,7 @@ test_range()
 	{  // check all false but last true
 		P ap[] = { {0, 1}, {0, 2}, {2, 1}, {2, 2}, {4, 1}, {4, 2}, {6, 1}, {6, 2}, {8, 1}, {1, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + 1);
 		CHECK(ap[0] == P{1, 2});
 		CHECK(ap[1] == P{0, 1});
@@ -308,7 +313,7 @@ test_range()
 	{  // check all true but first false
 		P ap[] = { {0, 1}, {1, 2}, {3, 1}, {3, 2}, {5, 1}, {5, 2}, {7, 1}, {7, 2}, {9, 1}, {9, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + size-1);
 		CHECK(ap[0] == P{1, 2});
 		CHECK(ap[1] == P{3, 1});
@@ -324,7 +329,7 @@ test_range()
 	{  // check all true but last false
 		P ap[] = { {1, 1}, {1, 2}, {3, 1}, {3, 2}, {5, 1}, {5, 2}, {7, 1}, {7, 2}, {9, 1}, {0, 2} };
 		std::size_t size = ranges::size(ap);
-		Iter r = ranges::stable_partition(::as_lvalue(ranges::ext::make_range(Iter(ap), Sent(ap+size))), odd_first());
+		Iter r = ranges::stable_partition(::as_lvalue(ranges::make_subrange(Iter(ap), Sent(ap+size))), odd_first());
 		CHECK(base(r) == ap + size-1);
 		CHECK(ap[0] == P{1, 1});
 		CHECK(ap[1] == P{1, 2});
@@ -352,8 +357,12 @@ struct move_only
 	move_only &operator=(move_only const &) = delete;
 };
 
+}
+
 int move_only::count = 0;
 
+namespace {
+
 template <class Iter>
 void
 test_move_only()
@@ -374,7 +383,29 @@ struct S
 	std::pair<int,int> p;
 };
 
-int main()
+// Compares against std::stable_partition, using a buffer of the given size
+// (or a temporary buffer if it is negative)
+template <typename T>
+void
+test_large(std::vector<T> v, int buf_size)
+{
+	const auto pred = [](const T& t) { return t % 3 == 0; };
+	std::vector<T> w = v;
+	const auto w_res = std::stable_partition(w.begin(), w.end(), pred);
+	typename std::vector<T>::iterator res;
+	if (buf_size < 0) {
+		res = ranges::stable_partition(v, pred);
+	} else {
+		std::vector<T> buf(buf_size);
+		res = ranges::stable_partition(v, buf, pred);
+	}
+	CHECK(res - v.begin() == w_res - w.begin());
+	CHECK(v == w);
+}
+
+}
+
+TEST_CASE("alg.stable_partition")
 {
 	test_iter<forward_iterator<std::pair<int,int>*> >();
 	test_iter<bidirectional_iterator<std::pair<int,int>*> >();
@@ -415,6 +446,7 @@ int main()
 		CHECK(ap[9].p == P{4, 2});
 	}
 
+#ifdef HAVE_RVALUE_RANGES
 	// Test rvalue ranges
 	using P = std::pair<int, int>;
 	{  // check mixed
@@ -432,6 +464,7 @@ int main()
 		CHECK(ap[8].p == P{4, 1});
 		CHECK(ap[9].p == P{4, 2});
 	}
+#endif
 
 	{
 		int some_ints[] = {1, 0};
@@ -441,5 +474,35 @@ int main()
 		CHECK(std::is_partitioned(first, last, even));
 	}
 
-	return ::test_result();
+	// Compare larger inputs against std::stable_partition, with contiguous
+	// trivially copyable elements (the branchless path) and otherwise
+	{
+		std::mt19937 gen;
+		std::vector<int> ints(1000);
+		for (int& i : ints)
+			i = static_cast<int>(gen() % 1000);
+		std::vector<long long> lls(ints.begin(), ints.end());
+		for (int buf_size : {-1, 0, 1, 10, 250, 500, 1000})
+		{
+			test_large(ints, buf_size);
+			test_large(lls, buf_size);
+		}
+	}
+
+	// Caller-supplied buffer with forward iterators and move-only types
+	{
+		move_only array[5] = { 1, 2, 3, 4, 5 };
+		std::vector<move_only> buf;
+		buf.emplace_back(0);
+		buf.emplace_back(0);
+		auto r = ranges::stable_partition(forward_iterator<move_only*>(array),
+		                                  forward_iterator<move_only*>(array + 5),
+		                                  buf, is_odd{}, &move_only::i);
+		CHECK(base(r) == array + 3);
+		CHECK(array[0].i == 1);
+		CHECK(array[1].i == 3);
+		CHECK(array[2].i == 5);
+		CHECK(array[3].i == 2);
+		CHECK(array[4].i == 4);
+	}
 }
@@ -18,20 +18,22 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include <stl2/detail/algorithm/stable_sort.hpp>
+#include <nanorange/algorithm/stable_sort.hpp>
 #include <cassert>
 #include <memory>
 #include <random>
 #include <vector>
 #include <algorithm>
-#include "../simple_test.hpp"
+#include "../catch.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
-namespace stl2 = __stl2;
+namespace stl2 = nano;
 
 namespace { std::mt19937 gen; }
 
+namespace {
+
 struct indirect_less
 {
 	template <class P>
@@ -43,7 +45,7 @@ template <class RI>
 void
 test_sort_helper(RI f, RI l)
 {
-	using value_type = stl2::value_type_t<RI>;
+	using value_type = stl2::iter_value_t<RI>;
 	auto stable_sort = make_testable_1<false>([](auto&&... args) {
 		return stl2::stable_sort(std::forward<decltype(args)>(args)...);
 	});
@@ -165,7 +167,9 @@ struct S
 	int i, j;
 };
 
-int main()
+}
+
+TEST_CASE("alg.stable_sort")
 {
 	// test null range
 	int d = 0;
@@ -218,6 +222,7 @@ int main()
 		}
 	}
 
+#ifdef HAVE_RVALUE_RANGES
 	// Check rvalue range
 	{
 		std::vector<S> v(1000, S{});
@@ -234,5 +239,56 @@ int main()
 		}
 	}
 
-	return ::test_result();
+#endif
+
+	// Check stability
+	{
+		std::vector<S> v(1000, S{});
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+		{
+			v[i].i = (i * 7) % 10;
+			v[i].j = i;
+		}
+		std::shuffle(v.begin(), v.end(), gen);
+		std::vector<S> w = v;
+		std::stable_sort(w.begin(), w.end(), [](S a, S b) { return a.i < b.i; });
+		stl2::stable_sort(v, std::less<int>{}, &S::i);
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+		{
+			CHECK(v[i].i == w[i].i);
+			CHECK(v[i].j == w[i].j);
+		}
+	}
+
+	// Check caller-supplied buffers of various sizes
+	for (std::size_t buf_size : {0, 1, 10, 250, 500, 1000})
+	{
+		std::vector<S> v(1000, S{});
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+		{
+			v[i].i = (i * 7) % 10;
+			v[i].j = i;
+		}
+		std::shuffle(v.begin(), v.end(), gen);
+		std::vector<S> w = v;
+		std::stable_sort(w.begin(), w.end(), [](S a, S b) { return a.i > b.i; });
+		std::vector<S> buf(buf_size);
+		CHECK(stl2::stable_sort(v.begin(), v.end(), buf, std::greater<int>{}, &S::i) == v.end());
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+		{
+			CHECK(v[i].i == w[i].i);
+			CHECK(v[i].j == w[i].j);
+		}
+	}
+
+	// Check move-only types with a caller-supplied buffer
+	{
+		std::vector<std::unique_ptr<int> > v(1000);
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+			v[i].reset(new int(v.size() - i - 1));
+		std::vector<std::unique_ptr<int> > buf(100);
+		stl2::stable_sort(v, buf, indirect_less());
+		for(int i = 0; (std::size_t)i < v.size(); ++i)
+			CHECK(*v[i] == i);
+	}
 }
@@ -1,8 +1,10 @@
 
 #include <nanorange/algorithm.hpp>
+#include <nanorange/iterator/back_insert_iterator.hpp>
 
 #include "../catch.hpp"
 
+#include <utility>
 #include <vector>
 
 TEST_CASE("alg.basic.lower_bound")
@@ -65,4 +67,106 @@ TEST_CASE("alg.basic.binary_search")
         CHECK(nano::binary_search(vec, 3));
         CHECK_FALSE((nano::binary_search(vec, 42)));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("alg.basic.sorted_index")
+{
+    SECTION("empty") {
+        std::vector<int> vec;
+        const auto idx = nano::make_sorted_index(vec);
+        CHECK(idx.empty());
+        CHECK(idx.lower_bound(1) == vec.end());
+        CHECK(idx.upper_bound(1) == vec.end());
+        CHECK_FALSE(idx.binary_search(1));
+    }
+
+    SECTION("with iters") {
+        std::vector<int> vec{1, 2, 2, 2, 3};
+        const auto idx = nano::make_sorted_index(vec.begin(), vec.end());
+        CHECK(idx.size() == 5);
+        CHECK(idx.lower_bound(2) == vec.begin() + 1);
+        CHECK(idx.upper_bound(2) == vec.begin() + 4);
+        auto rng = idx.equal_range(2);
+        CHECK(rng.begin() == vec.begin() + 1);
+        CHECK(rng.end() == vec.begin() + 4);
+        CHECK(idx.binary_search(3));
+        CHECK_FALSE(idx.binary_search(42));
+    }
+
+    SECTION("with comparator and projection") {
+        std::pair<int, int> arr[] = {{5, 0}, {4, 1}, {4, 2}, {1, 3}};
+        const auto idx = nano::make_sorted_index(arr);
+        CHECK(idx.lower_bound(4, nano::greater<>{}, &std::pair<int, int>::first) == arr + 1);
+        CHECK(idx.upper_bound(4, nano::greater<>{}, &std::pair<int, int>::first) == arr + 3);
+        CHECK(idx.binary_search(1, nano::greater<>{}, &std::pair<int, int>::first));
+        CHECK_FALSE(idx.binary_search(2, nano::greater<>{}, &std::pair<int, int>::first));
+    }
+
+    SECTION("against lower_bound") {
+        // Sizes around the powers of two, so that the last level of the tree
+        // is full, nearly full and nearly empty
+        for (int n : {1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 100, 1023, 1024, 1025}) {
+            std::vector<int> vec(n);
+            for (int i = 0; i < n; i++) {
+                vec[i] = i / 2 * 2;
+            }
+            const auto idx = nano::make_sorted_index(vec);
+            for (int v = -1; v <= n + 1; v++) {
+                CHECK(idx.lower_bound(v) == nano::lower_bound(vec, v));
+                CHECK(idx.upper_bound(v) == nano::upper_bound(vec, v));
+                CHECK(idx.binary_search(v) == nano::binary_search(vec, v));
+            }
+        }
+    }
+}
+
+TEST_CASE("alg.basic.batch_lower_bound")
+{
+    std::vector<int> vec{1, 2, 2, 2, 3};
+
+    SECTION("with iters") {
+        const int needles[] = {2, 0, 5, 3};
+        std::vector<std::vector<int>::iterator> out;
+        const auto res = nano::batch_lower_bound(vec.begin(), vec.end(),
+                                                 nano::begin(needles),
+                                                 nano::end(needles),
+                                                 nano::back_inserter(out));
+        CHECK(res.in == nano::end(needles));
+        REQUIRE(out.size() == 4);
+        CHECK(out[0] == vec.begin() + 1);
+        CHECK(out[1] == vec.begin());
+        CHECK(out[2] == vec.end());
+        CHECK(out[3] == vec.begin() + 4);
+    }
+
+    SECTION("with ranges, comparator and projection") {
+        std::pair<int, int> arr[] = {{5, 0}, {4, 1}, {4, 2}, {1, 3}};
+        const std::vector<int> needles{4, 6, 0};
+        std::pair<int, int>* out[3] = {};
+        nano::batch_lower_bound(arr, needles, out, nano::greater<>{},
+                                &std::pair<int, int>::first);
+        CHECK(out[0] == arr + 1);
+        CHECK(out[1] == arr);
+        CHECK(out[2] == arr + 4);
+    }
+
+    SECTION("against lower_bound") {
+        // More needles than are searched at once, and a haystack large
+        // enough to prefetch
+        for (int n : {0, 1, 2, 3, 17, 1000, 5000}) {
+            std::vector<int> hay(n);
+            for (int i = 0; i < n; i++) {
+                hay[i] = i / 2 * 2;
+            }
+            std::vector<int> needles;
+            for (int v = n + 1; v >= -1; v--) {
+                needles.push_back(v);
+            }
+            std::vector<std::vector<int>::iterator> out(needles.size());
+            nano::batch_lower_bound(hay, needles, out.begin());
+            for (std::size_t i = 0; i < needles.size(); i++) {
+                CHECK(out[i] == nano::lower_bound(hay, needles[i]));
+            }
+        }
+    }
+}
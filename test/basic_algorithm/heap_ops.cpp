@@ -3,6 +3,10 @@
 
 #include "../catch.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
 #include <vector>
 
 namespace {
@@ -12,6 +16,52 @@ const auto greater = [](const auto& lhs, const auto& rhs) {
     return lhs > rhs;
 };
 
+template <int D>
+void test_dary_heap(int n)
+{
+    std::vector<int> vec(n);
+    std::mt19937 gen(n);
+    std::uniform_int_distribution<int> dist(0, n / 2);
+    std::generate(vec.begin(), vec.end(), [&] { return dist(gen); });
+    std::vector<int> sorted = vec;
+    std::sort(sorted.begin(), sorted.end());
+
+    // make, then sort
+    {
+        auto copy = vec;
+        CHECK(nano::make_dary_heap<D>(copy) == copy.end());
+        CHECK(nano::is_dary_heap<D>(copy));
+        CHECK(nano::sort_dary_heap<D>(copy.begin(), copy.end()) == copy.end());
+        CHECK(copy == sorted);
+    }
+
+    // push one at a time, then pop one at a time
+    {
+        auto copy = vec;
+        for (auto it = copy.begin(); it != copy.end(); ++it) {
+            CHECK(nano::push_dary_heap<D>(copy.begin(), it + 1) == it + 1);
+            CHECK(nano::is_dary_heap_until<D>(copy.begin(), it + 1) == it + 1);
+        }
+        for (auto it = copy.end(); it != copy.begin(); --it) {
+            CHECK(*copy.begin() == *std::max_element(copy.begin(), it));
+            nano::pop_dary_heap<D>(copy.begin(), it);
+        }
+        CHECK(copy == sorted);
+    }
+
+    // with comparator and projection
+    {
+        std::vector<std::pair<int, int>> pairs;
+        for (int i : vec) {
+            pairs.emplace_back(i, 0);
+        }
+        nano::make_dary_heap<D>(pairs, greater, &std::pair<int, int>::first);
+        CHECK(nano::is_dary_heap<D>(pairs, greater, &std::pair<int, int>::first));
+        nano::sort_dary_heap<D>(pairs, greater, &std::pair<int, int>::first);
+        CHECK(std::is_sorted(pairs.rbegin(), pairs.rend()));
+    }
+}
+
 }
 
 TEST_CASE("alg.basic.is_heap")
@@ -158,6 +208,63 @@ TEST_CASE("alg.basic.sort_heap (with comparator)")
     REQUIRE(std::is_sorted(vec.begin(), vec.end(), greater));
 }
 
+TEST_CASE("alg.basic.sort_heap (bottom-up)")
+{
+    // Projected, non-scalar elements are popped by sifting up from a leaf
+    struct record {
+        std::string key;
+        int id;
+    };
+
+    const int n = 1000;
+    std::vector<record> vec;
+    std::mt19937 gen(n);
+    std::uniform_int_distribution<int> dist(0, n / 4);
+    for (int i = 0; i < n; i++) {
+        vec.push_back({std::to_string(dist(gen)), i});
+    }
+
+    int comparisons = 0;
+    const auto comp = [&](const std::string& lhs, const std::string& rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    };
+
+    nano::make_heap(vec.begin(), vec.end(), comp, &record::key);
+
+    SECTION("pop_heap") {
+        for (auto last = vec.end(); last != vec.begin(); --last) {
+            const auto max = std::max_element(
+                vec.begin(), last, [](const record& lhs, const record& rhs) {
+                    return lhs.key < rhs.key;
+                });
+            const std::string expected = max->key;
+            REQUIRE(nano::pop_heap(vec.begin(), last, comp, &record::key) ==
+                    last);
+            REQUIRE((last - 1)->key == expected);
+            REQUIRE(nano::is_heap(vec.begin(), last - 1, nano::less<>{},
+                                  &record::key));
+        }
+    }
+
+    SECTION("sort_heap") {
+        comparisons = 0;
+        nano::sort_heap(vec, comp, &record::key);
+        REQUIRE(nano::is_sorted(vec, nano::less<>{}, &record::key));
+        // Sifting down from the root would take nearer 2 n log2(n)
+        REQUIRE(comparisons < n * std::log2(n));
+    }
+
+    std::vector<int> ids;
+    for (const auto& r : vec) {
+        ids.push_back(r.id);
+    }
+    std::sort(ids.begin(), ids.end());
+    for (int i = 0; i < n; i++) {
+        REQUIRE(ids[i] == i);
+    }
+}
+
 TEST_CASE("alg.basic.push_heap")
 {
     std::vector<int> vec{3, 5, 2, 1, 4};
@@ -222,4 +329,24 @@ TEST_CASE("alg.basic.pop_heap (with comparator)")
     }
 
     REQUIRE(vec.back() == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("alg.basic.dary_heap")
+{
+    for (int n : {0, 1, 2, 3, 7, 8, 9, 64, 65, 1000}) {
+        test_dary_heap<2>(n);
+        test_dary_heap<3>(n);
+        test_dary_heap<4>(n);
+        test_dary_heap<8>(n);
+    }
+
+    // A 2-ary heap is an ordinary heap
+    std::vector<int> vec{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+    nano::make_dary_heap<2>(vec);
+    REQUIRE(std::is_heap(vec.begin(), vec.end()));
+
+    // ...but need not be a 4-ary one
+    vec = {9, 1, 8, 0, 0, 7, 7};
+    REQUIRE(nano::is_dary_heap<2>(vec));
+    REQUIRE(nano::is_dary_heap_until<4>(vec) == vec.begin() + 5);
+}
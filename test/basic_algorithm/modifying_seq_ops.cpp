@@ -5,11 +5,14 @@
 #include <nanorange/iterator/back_insert_iterator.hpp>
 #include <nanorange/iterator/ostream_iterator.hpp>
 
+#include <algorithm>
 #include <array>
 #include <complex>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <list>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -171,6 +174,130 @@ TEST_CASE("alg.basic.fill_n")
     REQUIRE(vec == (std::vector<int>{2, 2, 2, 0, 0}));
 }
 
+TEST_CASE("alg.basic.copy, move and fill (memmove)")
+{
+    // Contiguous ranges of trivially copyable types use memmove and memset
+    SECTION("copy") {
+        const std::vector<int> src{1, 2, 3, 4, 5};
+        std::vector<int> dest(5);
+        const auto res = rng::copy(src, dest.data());
+        REQUIRE(res.in == src.end());
+        REQUIRE(res.out == dest.data() + 5);
+        REQUIRE(dest == src);
+
+        const auto res_n = rng::copy_n(src.data() + 1, 3, dest.data());
+        REQUIRE(res_n.in == src.data() + 4);
+        REQUIRE(res_n.out == dest.data() + 3);
+        REQUIRE(dest == (std::vector<int>{2, 3, 4, 4, 5}));
+    }
+
+    SECTION("overlapping ranges") {
+        std::vector<int> vec{1, 2, 3, 4, 5, 6};
+        rng::copy(vec.data() + 2, vec.data() + 6, vec.data());
+        REQUIRE(vec == (std::vector<int>{3, 4, 5, 6, 5, 6}));
+
+        const auto res = rng::copy_backward(vec.data(), vec.data() + 4,
+                                            vec.data() + 6);
+        REQUIRE(res.in == vec.data() + 4);
+        REQUIRE(res.out == vec.data() + 2);
+        REQUIRE(vec == (std::vector<int>{3, 4, 3, 4, 5, 6}));
+
+        rng::move_backward(vec.data(), vec.data() + 5, vec.data() + 6);
+        REQUIRE(vec == (std::vector<int>{3, 3, 4, 3, 4, 5}));
+    }
+
+    SECTION("from move iterators") {
+        struct point { int x, y; };
+        point src[2] = {{1, 2}, {3, 4}};
+        point dest[2] = {};
+        const auto res = rng::copy(rng::make_move_iterator(src),
+                                   rng::make_move_iterator(src + 2), dest);
+        REQUIRE(res.in.base() == src + 2);
+        REQUIRE(res.out == dest + 2);
+        REQUIRE(dest[1].x == 3);
+        REQUIRE(dest[1].y == 4);
+
+        const auto res_m = rng::move(src, src + 1, dest + 1);
+        REQUIRE(res_m.out == dest + 2);
+        REQUIRE(dest[1].x == 1);
+    }
+
+    SECTION("fill") {
+        std::vector<char> vec(10);
+        REQUIRE(rng::fill(vec, 'a') == vec.end());
+        REQUIRE(rng::fill_n(vec.data(), 4, 'b') == vec.data() + 4);
+        REQUIRE(rng::fill_n(vec.data(), -1, 'c') == vec.data());
+        REQUIRE(vec == (std::vector<char>{'b', 'b', 'b', 'b', 'a',
+                                          'a', 'a', 'a', 'a', 'a'}));
+
+        // The value is converted just as by assignment
+        bool flags[3] = {};
+        rng::fill(flags, 2);
+        REQUIRE(flags[2]);
+    }
+}
+
+TEST_CASE("alg.basic.copy and fill (streaming stores)")
+{
+    // Ranges above the threshold may be written with non-temporal stores,
+    // starting from unaligned addresses and ending in a partial vector
+    constexpr auto bytes = rng::detail::stream_store_threshold + 37;
+
+    SECTION("copy") {
+        std::vector<char> src(bytes);
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<char>(i % 251);
+        }
+        std::vector<char> dest(bytes + 3);
+        const auto res = rng::copy(src, dest.data() + 3);
+        REQUIRE(res.in == src.end());
+        REQUIRE(res.out == dest.data() + dest.size());
+        REQUIRE(dest[0] == 0);
+        REQUIRE(std::equal(src.begin(), src.end(), dest.begin() + 3));
+    }
+
+    SECTION("stream_copy") {
+        // copy leaves large copies to memmove on glibc, which streams them
+        // itself, so call the kernel directly to make sure it is covered
+        std::vector<char> src(bytes);
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<char>(i % 251);
+        }
+        std::vector<char> dest(bytes + 5);
+        rng::detail::stream_copy(dest.data() + 3, src.data() + 1, bytes - 1);
+        REQUIRE(dest[2] == 0);
+        REQUIRE(std::equal(src.begin() + 1, src.end(), dest.begin() + 3));
+        REQUIRE(dest[bytes + 2] == 0);
+    }
+
+    SECTION("fill") {
+        std::vector<char> chars(bytes, 'a');
+        REQUIRE(rng::fill(chars.data() + 1, chars.data() + bytes - 1, 'b') ==
+                chars.data() + bytes - 1);
+        REQUIRE(chars.front() == 'a');
+        REQUIRE(chars.back() == 'a');
+        REQUIRE(std::count(chars.begin(), chars.end(), 'b') ==
+                static_cast<std::ptrdiff_t>(bytes - 2));
+
+        std::vector<double> doubles(bytes / sizeof(double));
+        REQUIRE(rng::fill_n(doubles.data() + 1, doubles.size() - 1, 1) ==
+                doubles.data() + doubles.size());
+        REQUIRE(doubles.front() == 0.0);
+        REQUIRE(std::count(doubles.begin(), doubles.end(), 1.0) ==
+                static_cast<std::ptrdiff_t>(doubles.size() - 1));
+
+        // Misaligned elements are filled correctly too
+        struct pair { short a, b; };
+        std::vector<char> buf(bytes);
+        const auto pairs = reinterpret_cast<pair*>(buf.data() + 2);
+        const auto n = static_cast<std::ptrdiff_t>((bytes - 2) / sizeof(pair));
+        REQUIRE(rng::fill_n(pairs, n, pair{1, 2}) == pairs + n);
+        REQUIRE(std::all_of(pairs, pairs + n, [](const pair& p) {
+            return p.a == 1 && p.b == 2;
+        }));
+    }
+}
+
 TEST_CASE("alg.basic.transform (unary)")
 {
     constexpr std::array<int, 5> src{{1, 2, 3, 4, 5}};
@@ -293,6 +420,61 @@ TEST_CASE("alg.basic.remove_if")
     }
 }
 
+TEST_CASE("alg.basic.remove, unique and copy_if (branch-free)")
+{
+    // Contiguous ranges of small trivially copyable types are filtered
+    // without branching on the predicate, and must give the same results as
+    // the standard library
+    std::mt19937 gen(24);
+    const auto odd = [](int i) { return i % 2 != 0; };
+
+    for (int i = 0; i < 300; i++) {
+        std::vector<int> vec(gen() % 600);
+        for (auto& x : vec) {
+            x = static_cast<int>(gen() % 4);
+        }
+
+        std::vector<int> expected;
+        std::copy_if(vec.begin(), vec.end(), std::back_inserter(expected), odd);
+        std::vector<int> out(vec.size());
+        const auto r = rng::copy_if(vec, out.data(), odd);
+        REQUIRE(r.in == vec.end());
+        REQUIRE(std::equal(out.data(), r.out, expected.begin(), expected.end()));
+
+        expected.clear();
+        std::remove_copy_if(vec.begin(), vec.end(),
+                            std::back_inserter(expected), odd);
+        std::vector<int> out2;
+        rng::remove_copy_if(vec, rng::back_inserter(out2), odd);
+        REQUIRE(out2 == expected);
+
+        auto a = vec;
+        auto b = vec;
+        auto ra = rng::remove_if(a, odd);
+        auto rb = std::remove_if(b.begin(), b.end(), odd);
+        REQUIRE(std::equal(a.begin(), ra, b.begin(), rb));
+
+        a = b = vec;
+        ra = rng::remove(a.data(), a.data() + a.size(), 2) - a.data() +
+             a.begin();
+        rb = std::remove(b.begin(), b.end(), 2);
+        REQUIRE(std::equal(a.begin(), ra, b.begin(), rb));
+
+        a = b = vec;
+        ra = rng::unique(a);
+        rb = std::unique(b.begin(), b.end());
+        REQUIRE(std::equal(a.begin(), ra, b.begin(), rb));
+    }
+
+    // unique keeps the first element of each run
+    struct entry { int key; int val; };
+    std::vector<entry> entries{{1, 0}, {1, 1}, {2, 2}, {2, 3}, {1, 4}};
+    const auto it = rng::unique(entries, rng::equal_to<>{}, &entry::key);
+    REQUIRE(it == entries.begin() + 3);
+    REQUIRE(entries[1].val == 2);
+    REQUIRE(entries[2].val == 4);
+}
+
 TEST_CASE("alg.basic.remove_copy")
 {
     // Something a bit different this time
@@ -485,6 +667,101 @@ TEST_CASE("alg.basic.reverse")
     }
 }
 
+namespace {
+
+struct rgb { unsigned char r, g, b; };
+
+// A trivially copyable type with its own swap(), which must still be used
+struct counted_swap {
+    int value;
+    friend void swap(counted_swap& a, counted_swap& b)
+    {
+        std::swap(a.value, b.value);
+        ++swaps;
+    }
+    static int swaps;
+};
+
+int counted_swap::swaps = 0;
+
+// Compares object representations, since the random elements below may be
+// NaNs
+template <typename T>
+bool same_bytes(const T* a, const T* b, std::ptrdiff_t n)
+{
+    return n == 0 ||
+           std::memcmp(a, b, sizeof(T) * static_cast<std::size_t>(n)) == 0;
+}
+
+template <typename T>
+void check_vectorised_permutations()
+{
+    std::mt19937 gen(25);
+    std::vector<T> vec;
+
+    for (int i = 0; i < 200; i++) {
+        const auto n = static_cast<std::ptrdiff_t>(gen() % 400);
+        vec.resize(n);
+        for (auto& x : vec) {
+            rng::fill_n(reinterpret_cast<unsigned char*>(&x), sizeof(T),
+                        static_cast<unsigned char>(gen()));
+        }
+        auto expected = vec;
+
+        std::reverse(expected.begin(), expected.end());
+        REQUIRE(rng::reverse(vec) == vec.end());
+        REQUIRE(same_bytes(vec.data(), expected.data(), n));
+
+        const auto mid = n == 0 ? 0 : gen() % n;
+        std::rotate(expected.begin(), expected.begin() + mid, expected.end());
+        const auto r = rng::rotate(vec, vec.begin() + mid);
+        REQUIRE(r.begin() == vec.begin() + (n - mid));
+        REQUIRE(r.end() == vec.end());
+        REQUIRE(same_bytes(vec.data(), expected.data(), n));
+
+        auto other = vec;
+        std::reverse(other.begin(), other.end());
+        const auto other_before = other;
+        const auto half = n / 2;
+        const auto res = rng::swap_ranges(vec.data(), vec.data() + half,
+                                          other.data(), other.data() + n);
+        REQUIRE(res.in1 == vec.data() + half);
+        REQUIRE(res.in2 == other.data() + half);
+        REQUIRE(same_bytes(vec.data(), other_before.data(), half));
+        REQUIRE(same_bytes(other.data(), expected.data(), half));
+        REQUIRE(same_bytes(other.data() + half, other_before.data() + half,
+                           n - half));
+    }
+}
+
+} // namespace
+
+TEST_CASE("alg.basic.reverse, swap_ranges and rotate (vectorised)")
+{
+    // Contiguous ranges of trivially copyable types are swapped a block at a
+    // time, and must give the same results as the standard library
+    check_vectorised_permutations<char>();
+    check_vectorised_permutations<short>();
+    check_vectorised_permutations<int>();
+    check_vectorised_permutations<double>();
+    check_vectorised_permutations<rgb>();
+
+    // Large rotations are done in several steps
+    std::vector<long> big(10000);
+    std::iota(big.begin(), big.end(), 0L);
+    auto expected = big;
+    for (const auto mid : {1, 63, 64, 65, 4000, 5000, 6001, 9999}) {
+        std::rotate(expected.begin(), expected.begin() + mid, expected.end());
+        rng::rotate(big, big.begin() + mid);
+        REQUIRE(big == expected);
+    }
+
+    std::vector<counted_swap> vec{{1}, {2}, {3}, {4}};
+    rng::reverse(vec);
+    REQUIRE(counted_swap::swaps == 2);
+    REQUIRE(vec[0].value == 4);
+}
+
 TEST_CASE("alg.basic.reverse_copy")
 {
     const std::list<int> list{1, 2, 3, 4, 5};
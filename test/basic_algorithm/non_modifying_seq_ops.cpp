@@ -3,7 +3,12 @@
 
 #include <nanorange/algorithm.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
 #include <vector>
 
 namespace rng = nano::ranges;
@@ -311,6 +316,47 @@ TEST_CASE("alg.basic.find_first_of (with predicate)")
     }
 }
 
+TEST_CASE("alg.basic.find_first_of (byte set)")
+{
+    // Sets of bytes are looked up in a table, and small ones compared
+    // against sixteen bytes of a contiguous range at a time
+    const std::string text = "the quick brown fox jumps over the lazy dog";
+    const std::string delims = " \t\r\n,;";
+
+    SECTION("with iterators") {
+        const auto it = rng::find_first_of(text.data(),
+                                           text.data() + text.size(),
+                                           delims.begin(), delims.end());
+        REQUIRE(it == text.data() + 3);
+    }
+
+    SECTION("with ranges") {
+        REQUIRE(rng::find_first_of(text, std::string("yz")) ==
+                text.begin() + 37);
+        REQUIRE(rng::find_first_of(text, std::string("!?")) == text.end());
+        REQUIRE(rng::find_first_of(text, std::string()) == text.end());
+    }
+
+    SECTION("compared with the naive search") {
+        // Sets small enough to compare directly, and larger ones
+        std::mt19937 gen(19);
+        for (int i = 0; i < 2000; i++) {
+            std::vector<signed char> hay(gen() % 100);
+            std::vector<signed char> set(gen() % 24);
+            for (auto& c : hay) {
+                c = static_cast<signed char>(gen() % 64 - 32);
+            }
+            for (auto& c : set) {
+                c = static_cast<signed char>(gen() % 64 - 32);
+            }
+
+            const auto expected = rng::find_first_of(
+                hay, set, [](signed char a, signed char b) { return a == b; });
+            REQUIRE(rng::find_first_of(hay, set) == expected);
+        }
+    }
+}
+
 TEST_CASE("alg.basic.adjacent_find")
 {
     const std::vector<int> vec{1, 2, 3, 3, 3, 4};
@@ -378,6 +424,228 @@ TEST_CASE("alg.basic.search (with predicate)")
     }
 }
 
+TEST_CASE("alg.basic.search (with searcher)")
+{
+    const std::string hay = "the quick brown fox jumps over the lazy dog";
+    const std::string needle = "the lazy";
+
+    const auto bmh = nano::make_boyer_moore_horspool_searcher(needle);
+    const auto two_way = nano::make_two_way_searcher(needle);
+
+    SECTION("with iterators") {
+        const auto sub1 = rng::search(hay.begin(), hay.end(), bmh);
+        CHECK(sub1.begin() == hay.begin() + 31);
+        CHECK(sub1.end() == hay.begin() + 39);
+        const auto sub2 = rng::search(hay.begin(), hay.end(), two_way);
+        CHECK(sub2.begin() == hay.begin() + 31);
+        CHECK(sub2.end() == hay.begin() + 39);
+    }
+
+    SECTION("with ranges") {
+        CHECK(rng::search(hay, bmh).begin() == hay.begin() + 31);
+        CHECK(rng::search(hay, two_way).begin() == hay.begin() + 31);
+        CHECK(rng::search(needle, bmh).begin() == needle.begin());
+    }
+
+    SECTION("not found") {
+        const std::string prefix = hay.substr(0, 35);
+        const auto sub = rng::search(prefix, two_way);
+        CHECK(sub.empty());
+        CHECK(sub.begin() == prefix.end());
+        CHECK(rng::search(hay.begin(), hay.begin() + 35, bmh).begin() ==
+              hay.begin() + 35);
+    }
+
+    SECTION("compared with the naive search") {
+        // Small alphabets give many partial matches, and periodic patterns
+        std::mt19937 gen(99);
+        for (int i = 0; i < 2000; i++) {
+            std::string h(gen() % 100, 'a');
+            std::string n(gen() % 8, 'a');
+            const char alphabet = static_cast<char>('a' + gen() % 3);
+            for (auto& c : h) {
+                c = static_cast<char>('a' + gen() % (alphabet - 'a' + 1));
+            }
+            for (auto& c : n) {
+                c = static_cast<char>('a' + gen() % (alphabet - 'a' + 1));
+            }
+
+            const auto expected = rng::search(h, n).begin();
+            CHECK(rng::search(h, nano::make_boyer_moore_horspool_searcher(n))
+                      .begin() == expected);
+            CHECK(rng::search(h, nano::make_two_way_searcher(n)).begin() ==
+                  expected);
+
+            // Wider elements use a hash table for the skips
+            const std::vector<int> hi(h.begin(), h.end());
+            const std::vector<int> ni(n.begin(), n.end());
+            const auto expected_i = rng::search(hi, ni).begin();
+            CHECK(rng::search(hi, nano::make_boyer_moore_horspool_searcher(ni))
+                      .begin() == expected_i);
+            CHECK(rng::search(hi, nano::make_two_way_searcher(ni)).begin() ==
+                  expected_i);
+        }
+    }
+}
+
+TEST_CASE("alg.basic.search (vectorised)")
+{
+    // Contiguous ranges of characters are searched sixteen positions at a
+    // time, so try haystacks longer than that, with matches at either end
+    const std::string hay = "abcabcabdabcabcabcabdabcabcabcabdabcab";
+
+    CHECK(rng::search(hay, std::string("abd")).begin() == hay.begin() + 6);
+    CHECK(rng::search(hay, std::string("abd")).end() == hay.begin() + 9);
+    CHECK(rng::find_end(hay, std::string("abd")).begin() == hay.begin() + 30);
+    CHECK(rng::search(hay, std::string("cab")).begin() == hay.begin() + 2);
+    CHECK(rng::find_end(hay, std::string("cab")).begin() == hay.begin() + 35);
+    CHECK(rng::search(hay, std::string("abe")).begin() == hay.end());
+    CHECK(rng::find_end(hay, std::string("abe")).begin() == hay.end());
+    CHECK(rng::search(hay, std::string()).begin() == hay.begin());
+    CHECK(rng::find_end(hay, std::string()).begin() == hay.end());
+
+    // Compare against std::search and std::find_end, using a small alphabet
+    // to give many partial matches
+    std::mt19937 gen(18);
+    for (int i = 0; i < 2000; i++) {
+        std::vector<unsigned char> h(gen() % 100);
+        std::vector<unsigned char> n(gen() % 6);
+        const unsigned alphabet = 1 + gen() % 3;
+        for (auto& c : h) {
+            c = static_cast<unsigned char>(gen() % alphabet);
+        }
+        for (auto& c : n) {
+            c = static_cast<unsigned char>(gen() % alphabet);
+        }
+
+        const auto first = std::search(h.begin(), h.end(), n.begin(), n.end());
+        const auto sub1 = rng::search(h, n);
+        CHECK(sub1.begin() == first);
+        CHECK(sub1.end() == (first == h.end() ? h.end() : first + n.size()));
+
+        const auto last = std::find_end(h.begin(), h.end(), n.begin(), n.end());
+        const auto sub2 = rng::find_end(h.data(), h.data() + h.size(),
+                                        n.data(), n.data() + n.size());
+        CHECK(sub2.begin() == h.data() + (last - h.begin()));
+        CHECK(sub2.end() == (last == h.end() ? h.data() + h.size()
+                                             : sub2.begin() + n.size()));
+    }
+}
+
+TEST_CASE("alg.basic.search (with a predicate for another type)")
+{
+    // std::equal_to<bool> treats all non-zero chars as equal, so neither the
+    // vectorised search nor the searchers' byte tables may be used
+    std::vector<char> hay(20, 9);
+    hay.insert(hay.end(), {1, 2, 0, 3, 4, 0, 0, 5});
+    const std::vector<char> needle{7, 0, 0};
+    const auto pred = std::equal_to<bool>{};
+
+    const auto first = std::search(hay.begin(), hay.end(), needle.begin(),
+                                   needle.end(), pred);
+    REQUIRE(first == hay.begin() + 24);
+    CHECK(rng::search(hay, needle, pred).begin() == first);
+    CHECK(rng::find_end(hay, needle, pred).begin() == first);
+
+    const auto hash = [](char c) { return std::hash<bool>{}(c != 0); };
+    CHECK(rng::search(hay, nano::make_boyer_moore_horspool_searcher(
+                               needle, hash, pred))
+              .begin() == first);
+    CHECK(rng::search(hay, nano::make_two_way_searcher(needle,
+                                                       std::less<bool>{}))
+              .begin() == first);
+}
+
+namespace {
+
+template <typename T>
+void check_vectorised_comparisons(std::mt19937& gen)
+{
+    for (int i = 0; i < 500; i++) {
+        std::vector<T> a(gen() % 60);
+        std::vector<T> b(gen() % 2 ? a.size() : gen() % 60);
+        for (auto& x : a) {
+            x = static_cast<T>(gen() % 3);
+        }
+        for (std::size_t j = 0; j < b.size(); j++) {
+            b[j] = j < a.size() && gen() % 8 != 0 ? a[j]
+                                                  : static_cast<T>(gen() % 3);
+        }
+        const T value = static_cast<T>(gen() % 4);
+
+        CHECK(rng::find(a, value) == std::find(a.begin(), a.end(), value));
+        CHECK(rng::count(a, value) == std::count(a.begin(), a.end(), value));
+        CHECK(rng::equal(a, b) ==
+              std::equal(a.begin(), a.end(), b.begin(), b.end()));
+        const auto m = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+        CHECK(rng::mismatch(a, b).in1 == m.first);
+        CHECK(rng::mismatch(a, b).in2 == m.second);
+        CHECK(rng::lexicographical_compare(a, b) ==
+              std::lexicographical_compare(a.begin(), a.end(), b.begin(),
+                                           b.end()));
+    }
+}
+
+} // namespace
+
+TEST_CASE("alg.basic.find, count, equal and mismatch (vectorised)")
+{
+    // Contiguous ranges of built-in types are compared using memchr and
+    // memcmp, or sixteen bytes at a time
+    std::mt19937 gen(20);
+    check_vectorised_comparisons<char>(gen);
+    check_vectorised_comparisons<signed char>(gen);
+    check_vectorised_comparisons<unsigned char>(gen);
+    check_vectorised_comparisons<short>(gen);
+    check_vectorised_comparisons<int>(gen);
+    check_vectorised_comparisons<unsigned>(gen);
+    check_vectorised_comparisons<long long>(gen);
+    check_vectorised_comparisons<float>(gen);
+    check_vectorised_comparisons<double>(gen);
+
+    // Values which the elements cannot hold are never found
+    const std::vector<unsigned char> bytes{0, 255, 1};
+    CHECK(rng::find(bytes, -1) == bytes.end());
+    CHECK(rng::find(bytes, 255) == bytes.begin() + 1);
+    CHECK(rng::find(bytes, 511) == bytes.end());
+    CHECK(rng::count(bytes, -1) == 0);
+    CHECK(rng::count(bytes, 255) == 1);
+
+    const std::vector<float> floats{0.0f, -0.0f, std::nanf(""), 1.0f, 0.0f};
+    CHECK(rng::count(floats, 0.0f) == 3);
+    CHECK(rng::count(floats, std::nanf("")) == 0);
+
+    const std::vector<signed char> sbytes{1, -1, 2};
+    CHECK(rng::find(sbytes, 255u) == sbytes.end());
+    CHECK(rng::find(sbytes, -1) == sbytes.begin() + 1);
+
+    // Nor are values of the opposite signedness which have the same
+    // representation as an element, but compare unequal after promotion
+    CHECK(rng::find(bytes, static_cast<signed char>(-1)) == bytes.end());
+    CHECK(rng::find(sbytes, static_cast<unsigned char>(255)) == sbytes.end());
+    CHECK(rng::find(sbytes.data(), sbytes.data() + sbytes.size(),
+                    static_cast<unsigned char>(255)) ==
+          sbytes.data() + sbytes.size());
+    const std::vector<char> chars(40, '\xff');
+    CHECK(rng::count(chars, static_cast<unsigned char>(0xFF)) == 0);
+    CHECK(rng::count(chars.data(), chars.data() + chars.size(),
+                     static_cast<unsigned char>(0xFF)) == 0);
+    CHECK(rng::count(chars, '\xff') == 40);
+    const std::vector<unsigned short> ushorts{1, 65535, 3};
+    CHECK(rng::find(ushorts, short{-1}) == ushorts.end());
+    CHECK(rng::find(ushorts, 65535) == ushorts.begin() + 1);
+    // ...unless the comparison is done in an unsigned type
+    CHECK(rng::find(sbytes, 0xFFFFFFFFu) == sbytes.begin() + 1);
+    const std::vector<unsigned> uints{1, 0xFFFFFFFFu, 3};
+    CHECK(rng::find(uints, -1) == uints.begin() + 1);
+
+    // Signed bytes must not be compared as unsigned
+    const std::vector<signed char> neg{-1};
+    const std::vector<signed char> pos{1};
+    CHECK(rng::lexicographical_compare(neg, pos));
+    CHECK_FALSE(rng::lexicographical_compare(pos, neg));
+}
+
 TEST_CASE("alg.basic.search_n")
 {
     const std::vector<int> vec{1, 2, 3, 4, 1, 1, 1};
@@ -394,6 +662,26 @@ TEST_CASE("alg.basic.search_n")
     }
 }
 
+TEST_CASE("alg.basic.search_n (random access)")
+{
+    // Runs which are one short of the count, so that every window has to
+    // be examined
+    std::vector<int> vec;
+    for (int i = 0; i < 20; i++) {
+        vec.insert(vec.end(), 4, 1);
+        vec.push_back(0);
+    }
+    vec.insert(vec.end(), 5, 1);
+
+    const auto sub = rng::search_n(vec, 5, 1);
+    CHECK(sub.begin() == vec.end() - 5);
+    CHECK(sub.end() == vec.end());
+
+    CHECK(rng::search_n(vec, 6, 1).begin() == vec.end());
+    CHECK(rng::search_n(vec, 0, 1).begin() == vec.begin());
+    CHECK(rng::search_n(vec, 1, 0).begin() == vec.begin() + 4);
+}
+
 TEST_CASE("alg.basic.search_n (with predicate)")
 {
     const std::vector<int> vec{1, 2, 3, 4, 1, 1, 1};
@@ -84,6 +84,15 @@ TEST_CASE("alg.basic.stable_partition")
         rng::stable_partition(src, is_even);
     }
 
+    SECTION("applies the predicate once per element") {
+        int calls = 0;
+        rng::stable_partition(src, [&](int i) {
+            ++calls;
+            return is_even(i);
+        });
+        CHECK(calls == static_cast<int>(src.size()));
+    }
+
     REQUIRE(src == test);
 }
 
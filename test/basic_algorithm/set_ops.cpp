@@ -5,9 +5,12 @@
 #include "../catch.hpp"
 #include "../test_utils.hpp"
 
+#include <cstdint>
 #include <iterator>
 #include <list>
+#include <random>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 TEST_CASE("alg.basic.merge")
@@ -46,6 +49,171 @@ TEST_CASE("alg.basic.merge")
     }
 }
 
+TEST_CASE("alg.basic.merge (parallel)")
+{
+    // Large enough to be split across several threads, with plenty of
+    // equivalent keys to check that the merge is stable
+    using pair_t = std::pair<int, int>;
+    const auto make_input = [](int size, int tag, unsigned seed) {
+        std::vector<pair_t> vec;
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> dist(0, 1000);
+        for (int i = 0; i < size; i++) {
+            vec.emplace_back(dist(gen), tag);
+        }
+        std::stable_sort(vec.begin(), vec.end(),
+                         [](const pair_t& a, const pair_t& b) {
+                             return a.first < b.first;
+                         });
+        return vec;
+    };
+
+    const auto check = [](const std::vector<pair_t>& in1,
+                          const std::vector<pair_t>& in2) {
+        const auto comp = [](const pair_t& a, const pair_t& b) {
+            return a.first < b.first;
+        };
+        std::vector<pair_t> expected(in1.size() + in2.size());
+        std::merge(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                   expected.begin(), comp);
+
+        std::vector<pair_t> out(expected.size());
+        const auto res = nano::merge(nano::execution::par, in1.begin(),
+                                     in1.end(), in2.begin(), in2.end(),
+                                     out.begin(), nano::less<>{}, &pair_t::first,
+                                     &pair_t::first);
+        CHECK(res.in1 == in1.end());
+        CHECK(res.in2 == in2.end());
+        CHECK(res.out == out.end());
+        CHECK(out == expected);
+
+        std::vector<pair_t> out2(expected.size());
+        const auto res2 = nano::merge(nano::execution::par, in1, in2,
+                                      out2.data(), comp);
+        CHECK(res2.out == out2.data() + out2.size());
+        CHECK(out2 == expected);
+    };
+
+    SECTION("with inputs of equal size") {
+        check(make_input(1 << 17, 1, 1), make_input(1 << 17, 2, 2));
+    }
+
+    SECTION("with inputs of unequal size") {
+        check(make_input(1 << 18, 1, 3), make_input(1000, 2, 4));
+        check(make_input(10, 1, 5), make_input(1 << 18, 2, 6));
+    }
+
+    SECTION("with an empty input") {
+        check(make_input(1 << 17, 1, 7), {});
+        check({}, make_input(1 << 17, 2, 8));
+        check({}, {});
+    }
+
+    SECTION("with sequenced policy") {
+        std::vector<int> v1{1, 3, 5};
+        std::vector<int> v2{2, 4, 6};
+        std::vector<int> out(6);
+        nano::merge(nano::execution::seq, v1, v2, out.begin());
+        CHECK(out == std::vector<int>{1, 2, 3, 4, 5, 6});
+    }
+}
+
+TEST_CASE("alg.basic.merge_k")
+{
+    SECTION("with vectors") {
+        const std::vector<std::vector<int>> in{
+            {1, 4, 7, 10}, {}, {2, 5, 8}, {3, 6, 9, 11, 12}, {}};
+        std::vector<int> out;
+
+        const auto res = nano::merge_k(in, nano::back_inserter(out));
+
+        CHECK(res.in == in.end());
+        CHECK(out == std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    }
+
+    SECTION("with input streams") {
+        struct stream_range {
+            std::istringstream is;
+
+            std::istream_iterator<int> begin()
+            {
+                return std::istream_iterator<int>{is};
+            }
+
+            std::istream_iterator<int> end() { return {}; }
+        };
+
+        std::vector<stream_range> in;
+        in.push_back({std::istringstream{"10 8 6 4 2"}});
+        in.push_back({std::istringstream{"9 7 5 3 1"}});
+        in.push_back({std::istringstream{"11 0"}});
+        std::vector<int> out;
+
+        nano::merge_k(in, nano::back_inserter(out), nano::greater<>{});
+
+        CHECK(out == std::vector<int>{11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0});
+    }
+
+    SECTION("with no ranges") {
+        const std::vector<std::vector<int>> in;
+        std::vector<int> out;
+        nano::merge_k(in, nano::back_inserter(out));
+        CHECK(out.empty());
+    }
+
+    SECTION("is stable") {
+        // Many ranges with plenty of equivalent keys, checked against a
+        // stable sort of their concatenation
+        using pair_t = std::pair<int, int>;
+        for (int k : {1, 2, 3, 7, 16, 33}) {
+            std::mt19937 gen(k);
+            std::uniform_int_distribution<int> len(0, 100);
+            std::uniform_int_distribution<int> key(0, 20);
+
+            std::vector<std::vector<pair_t>> in(k);
+            std::vector<pair_t> expected;
+            for (int i = 0; i < k; i++) {
+                for (int n = len(gen); n > 0; n--) {
+                    in[i].emplace_back(key(gen), i);
+                }
+                nano::stable_sort(in[i], nano::less<>{}, &pair_t::first);
+                expected.insert(expected.end(), in[i].begin(), in[i].end());
+            }
+            nano::stable_sort(expected, nano::less<>{}, &pair_t::first);
+
+            std::vector<pair_t> out(expected.size());
+            const auto res = nano::merge_k(in, out.begin(), nano::less<>{},
+                                           &pair_t::first);
+
+            CHECK(res.out == out.end());
+            CHECK(out == expected);
+        }
+    }
+
+    SECTION("with many short ranges") {
+        // Ranges which run out must not cost more than the log2(k)
+        // comparisons of an ordinary step
+        const int k = 1000;
+        std::vector<std::vector<int>> in(k);
+        for (int i = 0; i < k; i++) {
+            in[i].push_back((i * 7919) % k);
+        }
+
+        int comparisons = 0;
+        const auto comp = [&comparisons](int a, int b) {
+            ++comparisons;
+            return a < b;
+        };
+        std::vector<int> out;
+        nano::merge_k(in, nano::back_inserter(out), comp);
+
+        CHECK(nano::is_sorted(out));
+        CHECK(out.size() == std::size_t{k});
+        // k - 1 to build the tree, then at most log2(k) per element output
+        CHECK(comparisons <= (k - 1) + k * 10);
+    }
+}
+
 TEST_CASE("alg.basic.inplace_merge")
 {
     auto list = [] {
@@ -126,6 +294,59 @@ TEST_CASE("alg.basic.set_intersection")
     REQUIRE(vec == std::vector<int>{4, 3, 2});
 }
 
+TEST_CASE("alg.basic.set_intersection (vectorised)")
+{
+    // Sorted vectors of 32-bit integers take the vectorised path, so check
+    // it against std::set_intersection, with and without repeated values,
+    // and with unsigned values on both sides of the sign bit
+    std::mt19937 gen(42);
+
+    const auto make_input = [&gen](int size, std::uint32_t range,
+                                   std::uint32_t offset, bool unique) {
+        std::vector<std::uint32_t> vec;
+        std::uniform_int_distribution<std::uint32_t> dist(0, range);
+        for (int i = 0; i < size; i++) {
+            vec.push_back(dist(gen) + offset);
+        }
+        std::sort(vec.begin(), vec.end());
+        if (unique) {
+            vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+        }
+        return vec;
+    };
+
+    for (int i = 0; i < 200; i++) {
+        const bool unique = i % 2 == 0;
+        const std::uint32_t range = 1 + i;
+        const std::uint32_t offset = i % 4 < 2 ? 0 : 0x7fffffe0;
+        const auto in1 = make_input(i % 50, range, offset, unique);
+        const auto in2 = make_input((i * 7) % 50, range, offset, unique);
+
+        std::vector<std::uint32_t> expected;
+        std::set_intersection(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                              std::back_inserter(expected));
+
+        std::vector<std::uint32_t> out;
+        nano::set_intersection(in1, in2, nano::back_inserter(out));
+        CHECK(out == expected);
+
+        // The same values, as signed integers straddling zero
+        std::vector<std::int32_t> sin1, sin2, sexpected, sout;
+        for (auto u : in1) {
+            sin1.push_back(static_cast<std::int32_t>(u - offset) - 50);
+        }
+        for (auto u : in2) {
+            sin2.push_back(static_cast<std::int32_t>(u - offset) - 50);
+        }
+        std::set_intersection(sin1.begin(), sin1.end(), sin2.begin(),
+                              sin2.end(), std::back_inserter(sexpected));
+        nano::set_intersection(sin1.data(), sin1.data() + sin1.size(),
+                               sin2.data(), sin2.data() + sin2.size(),
+                               nano::back_inserter(sout));
+        CHECK(sout == sexpected);
+    }
+}
+
 TEST_CASE("alg.basic.set_symmetric_difference")
 {
     std::istringstream iss1{"5 4 3 2 1"};
@@ -218,4 +439,146 @@ TEST_CASE("alg.basic.includes")
         REQUIRE(nano::includes(rng1, rng2, nano::greater<>{}));
         REQUIRE_FALSE(nano::includes(rng1, rng3, nano::greater<>{}));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("alg.basic.set_ops (galloping)")
+{
+    // Random-access inputs of very different lengths, with long runs from
+    // each, are where the merge and set algorithms gallop. Pair the keys
+    // with a tag so we can see which range each output element came from.
+    using pair_t = std::pair<int, int>;
+    const auto comp = [](const pair_t& a, const pair_t& b) {
+        return a.first < b.first;
+    };
+
+    std::mt19937 gen(1234);
+    const auto make_input = [&](int size, int max, int tag) {
+        std::vector<pair_t> vec;
+        std::uniform_int_distribution<int> dist(0, max);
+        for (int i = 0; i < size; i++) {
+            vec.emplace_back(dist(gen), tag);
+        }
+        std::stable_sort(vec.begin(), vec.end(), comp);
+        return vec;
+    };
+
+    const auto check = [&](const std::vector<pair_t>& in1,
+                           const std::vector<pair_t>& in2) {
+        std::vector<pair_t> expected, out;
+
+        std::merge(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                   std::back_inserter(expected), comp);
+        const auto res = nano::merge(in1, in2, nano::back_inserter(out),
+                                     nano::less<>{}, &pair_t::first,
+                                     &pair_t::first);
+        CHECK(res.in1 == in1.end());
+        CHECK(res.in2 == in2.end());
+        CHECK(out == expected);
+
+        expected.clear();
+        out.clear();
+        std::set_intersection(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                              std::back_inserter(expected), comp);
+        nano::set_intersection(in1, in2, nano::back_inserter(out), comp);
+        CHECK(out == expected);
+
+        expected.clear();
+        out.clear();
+        std::set_difference(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                            std::back_inserter(expected), comp);
+        const auto res2 = nano::set_difference(in1, in2,
+                                               nano::back_inserter(out), comp);
+        CHECK(res2.in == in1.end());
+        CHECK(out == expected);
+
+        // Equivalent elements present in both ranges are taken from the
+        // second one, so compare only the keys here
+        expected.clear();
+        out.clear();
+        std::set_union(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                       std::back_inserter(expected), comp);
+        const auto res3 = nano::set_union(in1, in2, nano::back_inserter(out),
+                                          comp);
+        CHECK(res3.in1 == in1.end());
+        CHECK(res3.in2 == in2.end());
+        CHECK(nano::equal(out, expected, {}, &pair_t::first, &pair_t::first));
+
+        CHECK(nano::includes(in1, in2, comp) ==
+              std::includes(in1.begin(), in1.end(), in2.begin(), in2.end(),
+                            comp));
+    };
+
+    {
+        const auto big = make_input(100000, 1000000, 1);
+        const auto small = make_input(100, 1000000, 2);
+        check(big, small);
+        check(small, big);
+    }
+
+    {
+        // A subset of a long range is included in it, found by galloping
+        const auto big = make_input(100000, 1000000, 1);
+        std::vector<pair_t> sub;
+        for (std::size_t i = 0; i < big.size(); i += 997) {
+            sub.push_back(big[i]);
+        }
+        check(big, sub);
+        CHECK(nano::includes(big, sub, comp));
+    }
+
+    {
+        // Runs of equivalent keys, of every length up to a few hundred
+        const auto in1 = make_input(5000, 20, 1);
+        const auto in2 = make_input(3000, 30, 2);
+        check(in1, in2);
+        check(in2, in1);
+    }
+
+    {
+        // Long runs, alternating between the ranges
+        std::vector<pair_t> in1, in2;
+        for (int i = 0; i < 5000; i++) {
+            ((i / 50) % 2 == 0 ? in1 : in2).emplace_back(i, 0);
+        }
+        check(in1, in2);
+        check(in2, in1);
+        check(in1, {});
+        check({}, in2);
+    }
+
+    {
+        // Runs just long enough to start a gallop, which then ends at once.
+        // The probe which ends it must not be repeated by the next step, so
+        // merge stays within N1 + N2 - 1 comparisons.
+        std::vector<int> in1, in2;
+        for (int i = 0; i < 7000; i++) {
+            ((i / 7) % 2 == 0 ? in1 : in2).push_back(i);
+        }
+
+        int comparisons = 0;
+        int repeats = 0;
+        std::pair<int, int> prev{-1, -1};
+        const auto counting_less = [&](int a, int b) {
+            ++comparisons;
+            // (comparing equal elements both ways round is not a repeat)
+            repeats += (a != b && prev == std::make_pair(a, b));
+            prev = {a, b};
+            return a < b;
+        };
+
+        std::vector<int> out(in1.size() + in2.size());
+        nano::merge(in1, in2, out.begin(), counting_less);
+        CHECK(nano::is_sorted(out));
+        CHECK(comparisons <= static_cast<int>(out.size()) - 1);
+        CHECK(repeats == 0);
+
+        repeats = 0;
+        nano::set_union(in1, in2, out.begin(), counting_less);
+        nano::set_intersection(in1, in2, out.begin(), counting_less);
+        nano::set_difference(in1, in2, out.begin(), counting_less);
+        CHECK_FALSE(nano::includes(in1, in2, counting_less));
+        in1.insert(in1.end(), in2.begin(), in2.end());
+        nano::sort(in1);
+        CHECK(nano::includes(in1, in2, counting_less));
+        CHECK(repeats == 0);
+    }
+}
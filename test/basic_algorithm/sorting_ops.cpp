@@ -5,9 +5,17 @@
 
 #include "../test_utils.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <list>
+#include <numeric>
+#include <random>
 #include <sstream>
+#include <string>
 
 namespace rng = nano;
 
@@ -73,6 +81,81 @@ TEST_CASE("alg.basic.is_sorted_until (with comparator)")
     }
 }
 
+namespace {
+
+template <typename T>
+void check_vectorised_reductions(std::mt19937& gen)
+{
+    // A comparator other than less<> takes the plain loops
+    const auto lt = [](const T& a, const T& b) { return a < b; };
+
+    for (int i = 0; i < 500; i++) {
+        std::vector<T> vec(gen() % 70);
+        for (auto& x : vec) {
+            x = static_cast<T>(gen() % 5);
+        }
+        const T* const ptr = vec.data();
+        const T* const end = ptr + vec.size();
+
+        CHECK(rng::min_element(vec) == rng::min_element(vec, lt));
+        CHECK(rng::max_element(vec) == rng::max_element(vec, lt));
+        const auto mm = rng::minmax_element(ptr, end);
+        CHECK(mm.min == rng::min_element(ptr, end, lt));
+        CHECK(mm.max == rng::max_element(ptr, end, lt));
+
+        std::sort(vec.begin(), vec.begin() + gen() % (vec.size() + 1));
+        CHECK(rng::is_sorted_until(vec) == rng::is_sorted_until(vec, lt));
+        CHECK(rng::is_sorted(ptr, end) == std::is_sorted(ptr, end));
+    }
+
+    // The extremes of each type are ordered correctly
+    std::vector<T> limits(40, T(1));
+    limits[3] = std::numeric_limits<T>::max();
+    limits[25] = std::numeric_limits<T>::lowest();
+    CHECK(rng::min_element(limits) == limits.begin() + 25);
+    CHECK(rng::max_element(limits) == limits.begin() + 3);
+    CHECK(rng::is_sorted_until(limits) == limits.begin() + 4);
+}
+
+} // namespace
+
+TEST_CASE("alg.basic.min_element, max_element and is_sorted_until (vectorised)")
+{
+    // Contiguous ranges of arithmetic types are reduced sixteen bytes at a
+    // time, keeping the first least and last greatest elements
+    std::mt19937 gen(23);
+    check_vectorised_reductions<char>(gen);
+    check_vectorised_reductions<signed char>(gen);
+    check_vectorised_reductions<unsigned char>(gen);
+    check_vectorised_reductions<short>(gen);
+    check_vectorised_reductions<unsigned short>(gen);
+    check_vectorised_reductions<int>(gen);
+    check_vectorised_reductions<unsigned>(gen);
+    check_vectorised_reductions<long long>(gen);
+    check_vectorised_reductions<float>(gen);
+    check_vectorised_reductions<double>(gen);
+
+    // Ranges containing NaNs give the same results as the plain loops
+    const auto lt = [](float a, float b) { return a < b; };
+    std::vector<float> floats(20, 1.0f);
+    floats[2] = -0.0f;
+    floats[5] = 0.0f;
+    floats[9] = std::nanf("");
+    floats[14] = 0.0f;
+    CHECK(rng::min_element(floats) == rng::min_element(floats, lt));
+    CHECK(rng::max_element(floats) == rng::max_element(floats, lt));
+    const auto mm = rng::minmax_element(floats);
+    const auto mm_lt = rng::minmax_element(floats, lt);
+    CHECK(mm.min == mm_lt.min);
+    CHECK(mm.max == mm_lt.max);
+    CHECK(rng::is_sorted_until(floats) == floats.begin() + 2);
+
+    // Without them, zeros of either sign are equivalent
+    floats[9] = 2.0f;
+    CHECK(rng::min_element(floats) == floats.begin() + 2);
+    CHECK(rng::minmax_element(floats).max == floats.begin() + 9);
+}
+
 TEST_CASE("alg.basic.sort")
 {
     std::vector<int> vec{5, 3, 2, 4, 1};
@@ -103,6 +186,130 @@ TEST_CASE("alg.basic.sort (with comparator)")
     REQUIRE(std::is_sorted(vec.begin(), vec.end(), std::greater<>{}));
 }
 
+TEST_CASE("alg.basic.sort (parallel)")
+{
+    // Large enough to be split across several threads
+    std::vector<int> vec(1 << 18);
+    std::iota(vec.begin(), vec.end(), 0);
+    std::shuffle(vec.begin(), vec.end(), std::mt19937{});
+
+    SECTION("with iterators") {
+        const auto it = rng::sort(rng::execution::par, vec.begin(), vec.end());
+        REQUIRE(it == vec.end());
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with range") {
+        const auto it = rng::sort(rng::execution::par, vec);
+        REQUIRE(it == vec.end());
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with comparator and projection") {
+        const auto proj = [](int i) { return i / 4; };
+        rng::sort(rng::execution::par, vec, std::greater<>{}, proj);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end(), [&](int a, int b) {
+            return proj(a) > proj(b);
+        }));
+    }
+
+    SECTION("with many equal elements") {
+        for (auto& i : vec) {
+            i %= 3;
+        }
+        rng::sort(rng::execution::par_unseq, vec);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with sequenced policy") {
+        rng::sort(rng::execution::seq, vec);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+}
+
+TEST_CASE("alg.basic.sort (radix)")
+{
+    // Large enough to be sorted by key rather than by comparison
+    std::mt19937 gen{};
+
+    SECTION("with signed integers") {
+        std::vector<int> vec(1 << 14);
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        std::generate(vec.begin(), vec.end(), [&] { return dist(gen); });
+        rng::sort(vec);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with 64-bit integers") {
+        std::vector<std::uint64_t> vec(1 << 14);
+        std::generate(vec.begin(), vec.end(), [&] {
+            return (std::uint64_t{gen()} << 32) | gen();
+        });
+        rng::sort(vec);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with floating point numbers") {
+        std::vector<double> vec(1 << 14);
+        std::normal_distribution<double> dist;
+        std::generate(vec.begin(), vec.end(), [&] { return dist(gen); });
+        vec[0] = -0.0;
+        vec[1] = 0.0;
+        rng::sort(vec);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+    }
+
+    SECTION("with NaNs and signed zeros") {
+        // Keys are ordered by their bits: negatively-signed NaNs come first,
+        // then -0.0 before 0.0, and positively-signed NaNs last
+        const auto ordered_bits = [](double d) {
+            std::uint64_t u;
+            std::memcpy(&u, &d, sizeof(d));
+            return (u >> 63) ? ~u : (u | (std::uint64_t{1} << 63));
+        };
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const double specials[] = {nan, std::copysign(nan, -1.0), 0.0, -0.0};
+
+        std::vector<double> vec(1 << 14);
+        std::normal_distribution<double> dist;
+        std::uniform_int_distribution<int> pick(0, 7);
+        std::generate(vec.begin(), vec.end(), [&] {
+            const int i = pick(gen);
+            return i < 4 ? specials[i] : dist(gen);
+        });
+
+        auto expected = vec;
+        std::stable_sort(expected.begin(), expected.end(),
+                         [&](double a, double b) {
+                             return ordered_bits(a) < ordered_bits(b);
+                         });
+        rng::sort(vec);
+        REQUIRE(std::memcmp(vec.data(), expected.data(),
+                            vec.size() * sizeof(double)) == 0);
+
+        std::reverse(expected.begin(), expected.end());
+        rng::sort(vec, rng::greater<>{});
+        REQUIRE(std::memcmp(vec.data(), expected.data(),
+                            vec.size() * sizeof(double)) == 0);
+    }
+
+    SECTION("with greater and projection") {
+        struct S {
+            short key;
+            int index;
+        };
+        std::vector<S> vec(1 << 14);
+        std::uniform_int_distribution<short> dist(-100, 100);
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            vec[i] = S{dist(gen), int(i)};
+        }
+        rng::sort(vec, rng::greater<>{}, &S::key);
+        REQUIRE(std::is_sorted(vec.begin(), vec.end(), [](S a, S b) {
+            return a.key > b.key;
+        }));
+    }
+}
+
 TEST_CASE("alg.basic.partial_sort")
 {
     std::vector<int> vec{5, 4, 3, 2, 1};
@@ -184,6 +391,66 @@ TEST_CASE("alg.basic.partial_sort_copy (with comparator)")
     REQUIRE(vec[2] == 3);
 }
 
+TEST_CASE("alg.basic.top_k")
+{
+    SECTION("fed incrementally") {
+        rng::top_k<int, rng::greater<>> top(3);
+        std::istringstream iss{"3 1 4 1 5"};
+        top.insert(std::istream_iterator<int>{iss},
+                   std::istream_iterator<int>{});
+        REQUIRE(top.sorted() == (std::vector<int>{5, 4, 3}));
+
+        // cannot make the cut
+        REQUIRE_FALSE(top.push(2));
+        REQUIRE_FALSE(top.push(3));
+
+        REQUIRE(top.push(9));
+        const std::vector<int> more{2, 6, 5, 3};
+        top.insert(more);
+        REQUIRE(top.size() == 3);
+        REQUIRE(std::move(top).sorted() == (std::vector<int>{9, 6, 5}));
+    }
+
+    SECTION("fewer than k elements") {
+        rng::top_k<int> top(5);
+        const std::vector<int> in{3, 1, 2};
+        top.insert(in);
+        REQUIRE(top.sorted() == (std::vector<int>{1, 2, 3}));
+    }
+
+    SECTION("k = 0") {
+        rng::top_k<int> top(0);
+        REQUIRE_FALSE(top.push(1));
+        REQUIRE(top.empty());
+    }
+
+    SECTION("with projection, against partial_sort_copy") {
+        struct S {
+            int key;
+            std::string val;
+        };
+        std::mt19937 gen;
+        std::vector<S> in;
+        for (int i = 0; i < 1000; i++) {
+            const int key = static_cast<int>(gen() % 100);
+            in.push_back({key, std::to_string(i)});
+        }
+
+        rng::top_k<S, rng::less<>, int S::*> top(100, {}, &S::key);
+        for (std::size_t i = 0; i < in.size(); i += 30) {
+            top.insert(in.begin() + i, in.begin() + std::min(i + 30, in.size()));
+        }
+        std::vector<S> expected(100);
+        rng::partial_sort_copy(in, expected, rng::less<>{}, &S::key, &S::key);
+
+        const auto got = top.sorted();
+        REQUIRE(got.size() == 100);
+        for (std::size_t i = 0; i < 100; i++) {
+            REQUIRE(got[i].key == expected[i].key);
+        }
+    }
+}
+
 namespace {
 
 struct int_pair {
@@ -72,4 +72,56 @@ constexpr bool test_unique_copy()
 }
 static_assert(test_unique_copy(), "");
 
+constexpr bool is_odd(int i) { return i % 2 != 0; }
+
+constexpr bool test_remove_if_and_unique()
+{
+    {
+        carray<int, 6> arr{1, 2, 3, 4, 6, 7};
+        const auto it = nano::remove_if(arr, is_odd);
+        if (it != arr.begin() + 3 || arr[0] != 2 || arr[2] != 6) {
+            return false;
+        }
+    }
+
+    {
+        carray<int, 6> arr{1, 1, 2, 2, 2, 3};
+        const auto it = nano::unique(arr);
+        if (it != arr.begin() + 3 || arr[1] != 2 || arr[2] != 3) {
+            return false;
+        }
+    }
+
+    {
+        constexpr carray<int, 6> in{1, 2, 3, 4, 6, 7};
+        carray<int, 3> out{};
+        const auto r = nano::copy_if(in, out.begin(), is_odd);
+        if (r.out != out.end() || out[1] != 3 || out[2] != 7) {
+            return false;
+        }
+    }
+
+    return true;
+}
+static_assert(test_remove_if_and_unique(), "");
+
+constexpr bool test_reverse_and_rotate()
+{
+    carray<int, 5> arr{1, 2, 3, 4, 5};
+    carray<int, 5> other{};
+
+    if (nano::reverse(arr) != arr.end() || arr[0] != 5 || arr[4] != 1) {
+        return false;
+    }
+
+    const auto r = nano::rotate(arr, arr.begin() + 2);
+    if (r.begin() != arr.begin() + 3 || arr[0] != 3 || arr[4] != 4) {
+        return false;
+    }
+
+    nano::swap_ranges(arr, other);
+    return other[0] == 3 && arr[0] == 0;
+}
+static_assert(test_reverse_and_rotate(), "");
+
 }
\ No newline at end of file
@@ -27,4 +27,43 @@ constexpr bool test_sort()
 }
 static_assert(test_sort(), "");
 
+constexpr bool test_stable_sort_with_buffer()
+{
+    carray<int, 100> arr{};
+    for (int i = 0; i < 100; i++) {
+        arr[(size_t)i] = (i * 37) % 100;
+    }
+    carray<int, 10> buf{};
+    nano::stable_sort(arr, buf);
+    return nano::is_sorted(arr);
+}
+static_assert(test_stable_sort_with_buffer(), "");
+
+constexpr bool test_nth_element()
+{
+    constexpr int sz = 1'000;
+    carray<int, sz> arr{};
+    for (int i = 0; i < sz; i++) {
+        arr[(size_t)i] = (i * 37) % sz;
+    }
+    nano::nth_element(arr, arr.begin() + 123);
+    return arr[123] == 123;
+}
+static_assert(test_nth_element(), "");
+
+constexpr bool test_lower_bound()
+{
+    // large enough that the search would prefetch at runtime
+    constexpr int sz = 1'000;
+    carray<int, sz> arr{};
+    for (int i = 0; i < sz; i++) {
+        arr[(size_t)i] = 2 * i;
+    }
+    return nano::lower_bound(arr, 246) == arr.begin() + 123 &&
+           nano::lower_bound(arr, 247) == arr.begin() + 124 &&
+           nano::upper_bound(arr, 246) == arr.begin() + 124 &&
+           nano::lower_bound(arr, 2 * sz) == arr.end();
+}
+static_assert(test_lower_bound(), "");
+
 }
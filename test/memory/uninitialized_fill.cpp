@@ -97,3 +97,17 @@ TEST_CASE("mem.uninitialized_fill")
 
 	throw_test();
 }
+
+TEST_CASE("mem.uninitialized_fill (streaming stores)")
+{
+	// Large buffers of trivially copyable types use non-temporal stores
+	constexpr auto n = ranges::detail::stream_store_threshold / sizeof(int) + 5;
+	const auto independent = make_buffer<int>(n);
+
+	const auto p = ranges::uninitialized_fill(independent.begin() + 1, independent.end(), 42);
+	CHECK(p == independent.end());
+	CHECK(ranges::find_if(independent.begin() + 1, p, [](int i) { return i != 42; }) == p);
+
+	CHECK(ranges::uninitialized_fill_n(independent.begin(), n, 'a') == independent.end());
+	CHECK(ranges::find_if(independent.begin(), independent.end(), [](int i) { return i != 'a'; }) == independent.end());
+}